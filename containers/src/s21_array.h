@@ -3,11 +3,19 @@
 
 #include <math.h>
 
+#include <algorithm>
+#include <atomic>
 #include <initializer_list>
 #include <iostream>
+#include <memory>
+#include <type_traits>
 #include <utility>
 
+#include "s21_check.h"
+#include "s21_radix_sort.h"
+
 namespace s21 {
+inline namespace S21_BOUNDS_ABI {
 
 template <class T, std::size_t Size>
 class ArrayIterator;
@@ -15,11 +23,25 @@ class ArrayIterator;
 template <class T, std::size_t Size>
 class ArrayConstIterator;
 
+template <class... Fields>
+class soa_array;
+
 template <class T, std::size_t Size>
 class array {
  private:
   size_t m_size = Size;
   T *arr;
+  // Счётчик владельцев буфера arr: копии массива разделяют один буфер
+  // (copy-on-write) и отделяются от него при первой модификации.
+  std::atomic<size_t> *refs_ = nullptr;
+  // Сбрасывается, когда наружу выдана ссылка, итератор или указатель для
+  // записи: пока выданные ссылки могут использоваться, копии массива получают
+  // собственный буфер (иначе запись через ссылку была бы видна и в копиях).
+  // Снова выставляется методом share(), когда запись через них закончена.
+  bool shareable_ = true;
+
+  template <class... Fields>
+  friend class soa_array;
 
  public:
   using value_type = T;
@@ -30,54 +52,94 @@ class array {
   using size_type = size_t;
 
  private:
-  void free_array();
+  void free_array() noexcept;
+  void detach();
+  void leak();
 
  public:
-  array() : m_size(Size), arr(nullptr) {}
+  array() noexcept : m_size(Size), arr(nullptr), refs_(nullptr) {}
 
   explicit array(size_type n) : array() {
     m_size = n;
     arr = n ? new T[n] : nullptr;
+    refs_ = n ? new std::atomic<size_t>(1) : nullptr;
   }
   array(std::initializer_list<value_type> const &items);
-  array(const array &a) : m_size(a.m_size), arr(a.arr){};
-  array(array &&a) : m_size(a.m_size), arr(a.arr) {
+  // Копирование за O(1): буфер разделяется, счётчик владельцев растёт.
+  // Буфер, на который уже выданы ссылки для записи, копируется целиком
+  // (до вызова share()).
+  array(const array &a) : m_size(a.m_size), arr(a.arr), refs_(a.refs_) {
+    if (!a.shareable_) {
+      arr = nullptr;
+      refs_ = nullptr;
+      array copy = a.clone();
+      swap(copy);
+    } else if (refs_) {
+      refs_->fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+  array(array &&a) noexcept
+      : m_size(a.m_size), arr(a.arr), refs_(a.refs_), shareable_(a.shareable_) {
     a.arr = nullptr;
+    a.refs_ = nullptr;
     a.m_size = 0;
+    a.shareable_ = true;
   }
   ~array() { free_array(); }
-  array &operator=(array &&a) {
+  array &operator=(const array &a) {
+    if (this != &a) {
+      array tmp(a);
+      swap(tmp);
+    }
+    return *this;
+  }
+  array &operator=(array &&a) noexcept {
     if (this != &a) {
       free_array();
       m_size = a.m_size;
       arr = a.arr;
+      refs_ = a.refs_;
+      shareable_ = a.shareable_;
       a.arr = nullptr;
+      a.refs_ = nullptr;
       a.m_size = 0;
+      a.shareable_ = true;
     }
     return *this;
   };
 
+  // глубокая копия с собственным буфером
+  array clone() const;
+  // Запись через выданные ранее ссылки, итераторы и указатели закончена:
+  // следующие копии снова разделяют буфер за O(1)
+  void share() noexcept { shareable_ = true; }
+
   // методы для доступа к элементам класса
   reference at(size_type pos);
+  const_reference at(size_type pos) const;
   reference operator[](size_type pos);
-  const_reference front();
-  const_reference back();
+  const_reference operator[](size_type pos) const S21_CHECKED_NOEXCEPT;
+  const_reference front() const S21_CHECKED_NOEXCEPT;
+  const_reference back() const S21_CHECKED_NOEXCEPT;
   iterator data();
 
   //  методы для итерирования по элементам класса
   iterator begin();
   iterator end();
-  const_iterator begin() const;
-  const_iterator end() const;
+  const_iterator begin() const noexcept;
+  const_iterator end() const noexcept;
 
   // методы для доступа к информации о наполнении контейнера
-  bool empty();
-  size_type size();
-  size_type max_size();
+  bool empty() const noexcept;
+  size_type size() const noexcept;
+  size_type max_size() const noexcept;
 
   // методы для изменения контейнера
-  void swap(array &other);
+  void swap(array &other) noexcept;
   void fill(const_reference value);
+  void sort();
+  template <class KeyFn>
+  void sort_by_key(KeyFn key_fn);
 };
 
 template <class T, std::size_t Size>
@@ -90,49 +152,49 @@ class ArrayIterator {
   using reference = T &;
 
  public:
-  ArrayIterator() { ptr_ = nullptr; }
-  ArrayIterator(pointer ptr) { ptr_ = ptr; }
+  ArrayIterator() noexcept { ptr_ = nullptr; }
+  ArrayIterator(pointer ptr) noexcept { ptr_ = ptr; }
 
-  value_type &operator*() const { return (*ptr_); }
-  pointer operator->() { return ptr_; }
+  value_type &operator*() const noexcept { return (*ptr_); }
+  pointer operator->() noexcept { return ptr_; }
 
-  ArrayIterator &operator++() {
+  ArrayIterator &operator++() noexcept {
     ptr_++;
     return *this;
   }
 
-  ArrayIterator &operator--() {
+  ArrayIterator &operator--() noexcept {
     ptr_--;
     return *this;
   }
 
-  ArrayIterator operator++(int) {
+  ArrayIterator operator++(int) noexcept {
     ArrayIterator tmp = *this;
     ++(*this);
     return tmp;
   }
 
-  ArrayIterator operator--(int) {
+  ArrayIterator operator--(int) noexcept {
     ArrayIterator tmp = *this;
     --(*this);
     return tmp;
   }
 
-  ArrayIterator operator+(const size_t value) {
+  ArrayIterator operator+(const size_t value) noexcept {
     ArrayIterator tmp(this->ptr_ + value);
     return tmp;
   }
 
-  ArrayIterator operator-(const size_t value) {
+  ArrayIterator operator-(const size_t value) noexcept {
     ArrayIterator tmp(this->ptr_ - value);
     return tmp;
   }
 
-  bool operator==(const ArrayIterator &other) { return ptr_ == other.ptr_; }
+  bool operator==(const ArrayIterator &other) noexcept { return ptr_ == other.ptr_; }
 
-  bool operator!=(const ArrayIterator &other) { return ptr_ != other.ptr_; }
+  bool operator!=(const ArrayIterator &other) noexcept { return ptr_ != other.ptr_; }
 
-  operator ArrayConstIterator<T, Size>() const {
+  operator ArrayConstIterator<T, Size>() const noexcept {
     return ArrayConstIterator<T, Size>(ptr_);
   }
 
@@ -150,42 +212,42 @@ class ArrayConstIterator {
   using reference = T &;
 
  public:
-  ArrayConstIterator() { ptr_ = nullptr; };
-  ArrayConstIterator(pointer ptr) { ptr_ = ptr; };
-  value_type operator*() const { return (*ptr_); }
-  pointer operator->() { return ptr_; }
+  ArrayConstIterator() noexcept { ptr_ = nullptr; };
+  ArrayConstIterator(pointer ptr) noexcept { ptr_ = ptr; };
+  value_type operator*() const noexcept { return (*ptr_); }
+  pointer operator->() noexcept { return ptr_; }
 
-  ArrayConstIterator &operator++() {
+  ArrayConstIterator &operator++() noexcept {
     ptr_++;
     return *this;
   }
 
-  ArrayConstIterator &operator--() {
+  ArrayConstIterator &operator--() noexcept {
     ptr_--;
     return *this;
   }
 
-  ArrayConstIterator operator++(int) {
+  ArrayConstIterator operator++(int) noexcept {
     ArrayConstIterator tmp = *this;
     ++(*this);
     return tmp;
   }
 
-  ArrayConstIterator operator--(int) {
+  ArrayConstIterator operator--(int) noexcept {
     ArrayConstIterator tmp = *this;
     --(*this);
     return tmp;
   }
 
-  bool operator==(const ArrayConstIterator &other) {
+  bool operator==(const ArrayConstIterator &other) noexcept {
     return ptr_ == other.ptr_;
   }
 
-  bool operator!=(const ArrayConstIterator &other) {
+  bool operator!=(const ArrayConstIterator &other) noexcept {
     return ptr_ != other.ptr_;
   }
 
-  operator ArrayIterator<T, Size>() const {
+  operator ArrayIterator<T, Size>() const noexcept {
     return ArrayIterator<T, Size>(ptr_);
   }
 
@@ -193,6 +255,7 @@ class ArrayConstIterator {
   pointer ptr_;
 };
 
+}  // inline namespace S21_BOUNDS_ABI
 }  // namespace s21
 
 #include "s21_array.tpp"
@@ -1,6 +1,7 @@
 #include "s21_array.h"
 
 namespace s21 {
+inline namespace S21_BOUNDS_ABI {
 
 /**
  * @brief Конструктор для инициализации массива из списка инициализации.
@@ -14,6 +15,8 @@ template <class value_type, std::size_t Size>
 array<value_type, Size>::array(std::initializer_list<value_type> const& items) {
   // Выделяем память для массива размером, соответствующим количеству элементов в списке
   arr = new value_type[items.size()];
+  // Новый буфер пока принадлежит только этому массиву
+  refs_ = new std::atomic<size_t>(1);
   
   // Индекс для копирования значений из списка инициализации в массив
   int i = 0;
@@ -32,22 +35,95 @@ array<value_type, Size>::array(std::initializer_list<value_type> const& items) {
 /**
  * @brief Освобождает память, занятую массивом.
  *
- * Этот метод проверяет, был ли выделен массив, и если это так, 
- * освобождает выделенную память с помощью `delete[]`, 
- * затем сбрасывает указатель на массив в `nullptr` и 
- * устанавливает размер массива в 0.
+ * Этот метод проверяет, был ли выделен массив, и если это так,
+ * уменьшает счётчик владельцев буфера. Память освобождается с помощью
+ * `delete[]` только последним владельцем, после чего указатель на массив
+ * сбрасывается в `nullptr`, а размер массива устанавливается в 0.
  */
 template <class value_type, std::size_t Size>
-void array<value_type, Size>::free_array() {
+void array<value_type, Size>::free_array() noexcept {
   // Проверяем, был ли массив уже выделен
   if (arr != nullptr) {
-    // Освобождаем выделенную память
-    delete[] arr;
-    // Сбрасываем указатель на массив в nullptr для предотвращения "висячего" указателя
+    // Освобождаем память, только если других владельцев у буфера не осталось
+    if (refs_->fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      delete[] arr;
+      delete refs_;
+    }
+    // Сбрасываем указатели в nullptr для предотвращения "висячих" указателей
     arr = nullptr;
+    refs_ = nullptr;
     // Обнуляем размер массива
     m_size = 0;
   }
+  shareable_ = true;
+}
+
+/**
+ * @brief Отделяет массив от общего буфера перед модификацией.
+ *
+ * Если буфер разделяется с другими копиями массива, метод выделяет
+ * собственный буфер, копирует в него элементы и отпускает общий буфер.
+ * Если массив единственный владелец, метод ничего не делает, поэтому
+ * повторные модификации обходятся одной атомарной загрузкой.
+ */
+template <class value_type, std::size_t Size>
+void array<value_type, Size>::detach() {
+  // Единственному владельцу копировать нечего
+  if (refs_ == nullptr || refs_->load(std::memory_order_acquire) == 1) {
+    return;
+  }
+
+  // Копируем элементы в собственный буфер
+  value_type* copy = new value_type[m_size];
+  for (size_type i = 0; i < m_size; i++) {
+    copy[i] = arr[i];
+  }
+
+  // Отпускаем общий буфер: остальные владельцы могли успеть его освободить
+  if (refs_->fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    delete[] arr;
+    delete refs_;
+  }
+  arr = copy;
+  refs_ = new std::atomic<size_t>(1);
+}
+
+/**
+ * @brief Готовит буфер к выдаче ссылки, итератора или указателя для записи.
+ *
+ * Массив отделяется от общего буфера и помечается неразделяемым: пока
+ * выданная ссылка жива, запись через неё не должна попадать в копии,
+ * поэтому дальнейшие копии получают собственный буфер. Так продолжается до
+ * вызова share(), после которого копирование снова стоит O(1). После первого
+ * вызова остаётся только проверка флага, без обращения к счётчику владельцев.
+ */
+template <class value_type, std::size_t Size>
+void array<value_type, Size>::leak() {
+  if (shareable_) {
+    detach();
+    shareable_ = false;
+  }
+}
+
+/**
+ * @brief Создаёт глубокую копию массива.
+ *
+ * В отличие от конструктора копирования, который разделяет буфер,
+ * этот метод сразу выделяет новый буфер и копирует в него все элементы.
+ *
+ * @return Массив с собственной копией элементов.
+ */
+template <class value_type, std::size_t Size>
+array<value_type, Size> array<value_type, Size>::clone() const {
+  // У массива, созданного конструктором по умолчанию, буфера нет
+  if (arr == nullptr) {
+    return array();
+  }
+  array result(m_size);
+  for (size_type i = 0; i < m_size; i++) {
+    result.arr[i] = arr[i];
+  }
+  return result;
 }
 
 
@@ -69,54 +145,93 @@ typename array<value_type, Size>::reference array<value_type, Size>::at(
     // Если индекс невалиден, генерируем исключение
     throw std::out_of_range("InvalidIndexError: Index is out of range");
   }
-  
+
+  // Ссылка допускает запись, поэтому отделяемся от общего буфера
+  leak();
+
   // Возвращаем ссылку на элемент массива по индексу
   return arr[pos];
 }
 
+/**
+ * @brief Возвращает константную ссылку на элемент массива по указанному индексу.
+ *
+ * Версия для чтения: не отделяет массив от общего буфера и не обращается
+ * к счётчику владельцев.
+ *
+ * @param pos Индекс элемента, к которому нужно получить доступ.
+ * @return Константная ссылка на элемент массива по указанному индексу.
+ * @throws std::out_of_range Если индекс выходит за пределы массива.
+ */
+template <class value_type, std::size_t Size>
+typename array<value_type, Size>::const_reference array<value_type, Size>::at(
+    size_type pos) const {
+  if (m_size <= pos) {
+    throw std::out_of_range("InvalidIndexError: Index is out of range");
+  }
+  return arr[pos];
+}
+
 
 /**
  * @brief Возвращает ссылку на элемент массива по указанному индексу.
  *
  * Этот метод позволяет получить доступ к элементу массива по индексу.
- * Если индекс выходит за пределы массива, генерируется исключение `std::out_of_range`.
- * В отличие от метода `at()`, который обычно используется для проверки границ,
- * этот оператор предоставляет доступ без явной проверки для быстродействия.
+ * Проверка индекса зависит от политики S21_BOUNDS_CHECK (см. s21_check.h):
+ * по умолчанию при выходе за границы генерируется исключение `std::out_of_range`,
+ * а в режиме `S21_CHECK_NONE` проверки нет, как и положено оператору для быстродействия.
+ * Для проверки границ в любом режиме используйте метод `at()`.
+ * Ссылка допускает запись, поэтому общий буфер копируется (copy-on-write) в любом
+ * режиме: метод может выделять память и noexcept не объявлен.
  *
  * @param pos Индекс элемента, к которому нужно получить доступ.
  * @return Ссылка на элемент массива по указанному индексу.
- * @throws std::out_of_range Если индекс выходит за пределы массива.
+ * @throws std::out_of_range Если индекс выходит за пределы массива (режим `S21_CHECK_THROW`).
  */
 template <class value_type, std::size_t Size>
 typename array<value_type, Size>::reference array<value_type, Size>::operator[](
     size_type pos) {
   // Проверяем, что индекс не выходит за пределы массива
-  if (m_size <= pos) {
-    // Если индекс невалиден, генерируем исключение
-    throw std::out_of_range("InvalidIndexError: Index is out of range");
-  }
+  detail::check_bounds(pos < m_size, "InvalidIndexError: Index is out of range");
+
+  // Ссылка допускает запись, поэтому отделяемся от общего буфера
+  leak();
 
   // Возвращаем ссылку на элемент массива по индексу
   return arr[pos];
 }
 
+/**
+ * @brief Возвращает константную ссылку на элемент массива по указанному индексу.
+ *
+ * Версия для чтения: не отделяет массив от общего буфера и не обращается
+ * к счётчику владельцев.
+ *
+ * @param pos Индекс элемента, к которому нужно получить доступ.
+ * @return Константная ссылка на элемент массива по указанному индексу.
+ * @throws std::out_of_range Если индекс выходит за пределы массива.
+ */
+template <class value_type, std::size_t Size>
+typename array<value_type, Size>::const_reference
+array<value_type, Size>::operator[](size_type pos) const S21_CHECKED_NOEXCEPT {
+  detail::check_bounds(pos < m_size, "InvalidIndexError: Index is out of range");
+  return arr[pos];
+}
+
 /**
  * @brief Возвращает ссылку на первый элемент массива.
  *
  * Этот метод возвращает ссылку на первый элемент массива. Если массив пуст (его размер меньше или равен нулю),
- * генерируется исключение `std::out_of_range`.
+ * генерируется исключение `std::out_of_range` (в режиме `S21_CHECK_THROW`, см. s21_check.h).
  *
  * @return Ссылка на первый элемент массива.
  * @throws std::out_of_range Если массив пуст.
  */
 template <class value_type, std::size_t Size>
 typename array<value_type, Size>::const_reference
-array<value_type, Size>::front() {
+array<value_type, Size>::front() const S21_CHECKED_NOEXCEPT {
   // Проверяем, что массив не пуст
-  if (m_size <= 0) {
-    // Если массив пуст, генерируем исключение
-    throw std::out_of_range("InvalidIndexError: Index is out of range");
-  }
+  detail::check_bounds(m_size > 0, "InvalidIndexError: Index is out of range");
 
   // Возвращаем ссылку на первый элемент массива
   return arr[0];
@@ -127,19 +242,16 @@ array<value_type, Size>::front() {
  * @brief Возвращает ссылку на последний элемент массива.
  *
  * Этот метод возвращает ссылку на последний элемент массива. Если массив пуст (его размер меньше или равен нулю),
- * генерируется исключение `std::out_of_range`.
+ * генерируется исключение `std::out_of_range` (в режиме `S21_CHECK_THROW`, см. s21_check.h).
  *
  * @return Ссылка на последний элемент массива.
  * @throws std::out_of_range Если массив пуст.
  */
 template <class value_type, std::size_t Size>
 typename array<value_type, Size>::const_reference
-array<value_type, Size>::back() {
+array<value_type, Size>::back() const S21_CHECKED_NOEXCEPT {
   // Проверяем, что массив не пуст
-  if (m_size <= 0) {
-    // Если массив пуст, генерируем исключение
-    throw std::out_of_range("InvalidIndexError: Index is out of range");
-  }
+  detail::check_bounds(m_size > 0, "InvalidIndexError: Index is out of range");
 
   // Возвращаем ссылку на последний элемент массива
   return arr[m_size - 1];
@@ -155,6 +267,7 @@ array<value_type, Size>::back() {
  */
 template <class value_type, std::size_t Size>
 typename array<value_type, Size>::iterator array<value_type, Size>::data() {
+  leak();
   return arr;
 }
 
@@ -163,11 +276,13 @@ typename array<value_type, Size>::iterator array<value_type, Size>::data() {
  *
  * Этот метод возвращает итератор, который указывает на первый элемент массива. Это основной метод,
  * позволяющий начать итерацию по элементам массива.
+ * Итератор допускает запись, поэтому массив предварительно отделяется от общего буфера.
  *
  * @return Итератор на первый элемент массива.
  */
 template <class value_type, std::size_t Size>
 typename array<value_type, Size>::iterator array<value_type, Size>::begin() {
+  leak();
   return iterator(arr);
 }
 
@@ -181,6 +296,7 @@ typename array<value_type, Size>::iterator array<value_type, Size>::begin() {
  */
 template <class value_type, std::size_t Size>
 typename array<value_type, Size>::iterator array<value_type, Size>::end() {
+  leak();
   return iterator(arr + m_size);
 }
 
@@ -194,7 +310,7 @@ typename array<value_type, Size>::iterator array<value_type, Size>::end() {
  */
 template <class value_type, std::size_t Size>
 typename array<value_type, Size>::const_iterator
-array<value_type, Size>::begin() const {
+array<value_type, Size>::begin() const noexcept {
   return const_iterator(arr);
 }
 
@@ -208,7 +324,7 @@ array<value_type, Size>::begin() const {
  */
 template <class value_type, std::size_t Size>
 typename array<value_type, Size>::const_iterator array<value_type, Size>::end()
-    const {
+    const noexcept {
   return const_iterator(arr + m_size);
 }
 
@@ -220,7 +336,7 @@ typename array<value_type, Size>::const_iterator array<value_type, Size>::end()
  * @return `true`, если массив пуст; `false`, если в нем есть элементы.
  */
 template <typename T, std::size_t Size>
-bool array<T, Size>::empty() {
+bool array<T, Size>::empty() const noexcept {
   return (m_size == 0) ? true : false;
 }
 
@@ -232,7 +348,8 @@ bool array<T, Size>::empty() {
  * @return Текущий размер массива.
  */
 template <class value_type, std::size_t Size>
-typename array<value_type, Size>::size_type array<value_type, Size>::size() {
+typename array<value_type, Size>::size_type array<value_type, Size>::size()
+    const noexcept {
   return m_size;
 }
 
@@ -248,7 +365,7 @@ typename array<value_type, Size>::size_type array<value_type, Size>::size() {
  */
 template <class value_type, std::size_t Size>
 typename array<value_type, Size>::size_type
-array<value_type, Size>::max_size() {
+array<value_type, Size>::max_size() const noexcept {
   // Вычисляем максимальный размер массива, основанный на типе value_type
   size_t result = pow(2, (64 - log(sizeof(value_type)) / log(2))) - 1;
   return result;
@@ -265,11 +382,14 @@ array<value_type, Size>::max_size() {
  * @param other Другой массив, с которым нужно обменяться содержимым.
  */
 template <class value_type, std::size_t Size>
-void array<value_type, Size>::swap(array& other) {
+void array<value_type, Size>::swap(array& other) noexcept {
   // Обмен значений m_size
   std::swap(other.m_size, m_size);
   // Обмен значений arr (указателей)
   std::swap(other.arr, arr);
+  // Обмен счётчиков владельцев и признаков разделяемости буферов
+  std::swap(other.refs_, refs_);
+  std::swap(other.shareable_, shareable_);
 }
 
 /**
@@ -283,6 +403,9 @@ void array<value_type, Size>::swap(array& other) {
  */
 template <class value_type, std::size_t Size>
 void array<value_type, Size>::fill(const_reference value) {
+  // Заполнение меняет элементы, поэтому отделяемся от общего буфера
+  detach();
+
   // Проходим по всем элементам массива и заполняем их указанным значением
   for (size_type i = 0; i < m_size; i++) {
     arr[i] = value;
@@ -290,5 +413,48 @@ void array<value_type, Size>::fill(const_reference value) {
 }
 
 
+/**
+ * @brief Сортирует массив по возрастанию.
+ *
+ * Для целых, float и double используется устойчивая поразрядная сортировка
+ * (LSD radix) с временным буфером того же размера: она не сравнивает элементы
+ * и потому не страдает от ошибок предсказания ветвлений. Для остальных типов
+ * используется устойчивая сортировка сравнением (`operator<`).
+ */
+template <class value_type, std::size_t Size>
+void array<value_type, Size>::sort() {
+  // Сортировка меняет элементы, поэтому отделяемся от общего буфера
+  detach();
+  if constexpr (detail::has_radix_key<value_type>) {
+    sort_by_key([](const value_type& value) { return value; });
+  } else {
+    std::stable_sort(arr, arr + m_size);
+  }
+}
+
+/**
+ * @brief Устойчиво сортирует массив по арифметическому ключу.
+ *
+ * Ключ `key_fn(element)` вычисляется на каждом проходе поразрядной сортировки,
+ * элементы переставляются через временный буфер того же размера. Пример:
+ * `records.sort_by_key([](const Record& r) { return r.price; })`.
+ *
+ * @param key_fn Функция, возвращающая арифметический ключ элемента.
+ */
+template <class value_type, std::size_t Size>
+template <class KeyFn>
+void array<value_type, Size>::sort_by_key(KeyFn key_fn) {
+  if (m_size < 2) {
+    return;
+  }
+  detach();
+  std::unique_ptr<value_type[]> scratch(new value_type[m_size]);
+  detail::radix_sort(arr, scratch.get(), m_size, [&key_fn](const value_type& value) {
+    return detail::radix_key(key_fn(value));
+  });
+}
+
+
 // template class array<int>;
+}  // inline namespace S21_BOUNDS_ABI
 }  // namespace s21
@@ -0,0 +1,100 @@
+#ifndef S21_ARRAY_VIEW_H
+#define S21_ARRAY_VIEW_H
+
+#include <cstddef>
+#include <stdexcept>
+
+#include "s21_array.h"
+
+namespace s21 {
+
+// Порядок хранения многомерных данных в плоском буфере
+enum class layout { row_major, column_major };
+
+// Невладеющее многомерное представление плоского буфера (в духе std::mdspan).
+// Хранит указатель на данные, размеры по каждому измерению и шаги (strides) в
+// элементах. Индексация через operator() не проверяет границы и сводится к
+// одному скалярному произведению, поэтому циклы по ней векторизуются;
+// проверяемый доступ — через at().
+template <class T, std::size_t Rank>
+class array_view {
+  static_assert(Rank > 0, "array_view requires at least one dimension");
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using pointer = T *;
+  using size_type = std::size_t;
+
+ private:
+  pointer data_ = nullptr;       // Указатель на первый элемент представления
+  size_type extents_[Rank] = {}; // Размеры по измерениям
+  size_type strides_[Rank] = {}; // Шаги по измерениям (в элементах)
+
+  template <class, std::size_t>
+  friend class array_view;
+
+ public:
+  array_view() {}
+  // Плотное представление с заданными размерами и порядком хранения
+  array_view(pointer data, const size_type (&extents)[Rank],
+             layout order = layout::row_major);
+  // Представление с явно заданными шагами
+  array_view(pointer data, const size_type (&extents)[Rank],
+             const size_type (&strides)[Rank]);
+  // Представление поверх s21::array (массив отделяется от общего буфера
+  // и больше не разделяет его со своими копиями)
+  template <std::size_t Size>
+  array_view(array<T, Size> &source, const size_type (&extents)[Rank],
+             layout order = layout::row_major);
+
+  // Доступ к элементам
+  template <class... Indices>
+  reference operator()(Indices... indices) const {
+    static_assert(sizeof...(Indices) == Rank, "wrong number of indices");
+    const size_type index[Rank] = {static_cast<size_type>(indices)...};
+    size_type offset = 0;
+    for (size_type d = 0; d < Rank; d++) offset += index[d] * strides_[d];
+    return data_[offset];
+  }
+  template <class... Indices>
+  reference at(Indices... indices) const;
+
+  // Информация о представлении
+  pointer data() const { return data_; }
+  size_type extent(size_type dim) const { return extents_[dim]; }
+  size_type stride(size_type dim) const { return strides_[dim]; }
+  size_type size() const;
+  bool empty() const { return size() == 0; }
+  bool is_contiguous() const;  // Элементы лежат подряд без пропусков
+
+  // Срезы
+  array_view subview(const size_type (&offsets)[Rank],
+                     const size_type (&extents)[Rank]) const;  // Под-блок
+  array_view strided(size_type dim, size_type step) const;  // Каждый step-й по измерению
+  array_view transposed() const;  // Измерения в обратном порядке, без копирования
+  template <std::size_t R = Rank>
+  array_view<T, R - 1> slice(size_type dim, size_type index) const;  // Фиксация одного индекса
+};
+
+// Обход двумерного представления плитками tile_rows x tile_cols.
+// Внутри плитки индексы перебираются так, чтобы шаг по памяти был меньше,
+// поэтому при транспонировании и стенсильных проходах плитка обоих
+// представлений остаётся в кэше. f вызывается как f(i, j, view(i, j)).
+template <class T, class Function>
+void for_each_tile(const array_view<T, 2> &view, std::size_t tile_rows,
+                   std::size_t tile_cols, Function f);
+
+// То же, но с размером плитки, подобранным под L1-кэш (около 16 КБ на плитку).
+template <class T, class Function>
+void for_each_tile(const array_view<T, 2> &view, Function f);
+
+// Копирование плитками (например, транспонирование в dst = src.transposed()).
+template <class T>
+void copy_tiled(const array_view<T, 2> &src, const array_view<T, 2> &dst);
+
+}  // namespace s21
+
+#include "s21_array_view.tpp"
+
+#endif  // S21_ARRAY_VIEW_H
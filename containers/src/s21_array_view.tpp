@@ -0,0 +1,270 @@
+#include <cmath>
+
+#include "s21_array_view.h"
+
+namespace s21 {
+
+/**
+ * @brief Создаёт плотное представление буфера.
+ *
+ * Шаги вычисляются по размерам: при `layout::row_major` быстрее всего меняется
+ * последний индекс, при `layout::column_major` — первый.
+ *
+ * @param data Указатель на первый элемент буфера.
+ * @param extents Размеры по каждому измерению.
+ * @param order Порядок хранения элементов.
+ */
+template <class T, std::size_t Rank>
+array_view<T, Rank>::array_view(pointer data, const size_type (&extents)[Rank],
+                                layout order)
+    : data_(data) {
+  size_type step = 1;
+  for (size_type i = 0; i < Rank; i++) {
+    // Измерение, шаг которого вычисляется на этой итерации
+    size_type d = order == layout::row_major ? Rank - 1 - i : i;
+    extents_[d] = extents[d];
+    strides_[d] = step;
+    step *= extents[d];
+  }
+}
+
+/**
+ * @brief Создаёт представление с явно заданными шагами.
+ *
+ * @param data Указатель на первый элемент представления.
+ * @param extents Размеры по каждому измерению.
+ * @param strides Шаги по каждому измерению в элементах.
+ */
+template <class T, std::size_t Rank>
+array_view<T, Rank>::array_view(pointer data, const size_type (&extents)[Rank],
+                                const size_type (&strides)[Rank])
+    : data_(data) {
+  for (size_type d = 0; d < Rank; d++) {
+    extents_[d] = extents[d];
+    strides_[d] = strides[d];
+  }
+}
+
+/**
+ * @brief Создаёт плотное представление поверх s21::array.
+ *
+ * Через представление можно писать в массив, поэтому массив предварительно
+ * отделяется от общего буфера (см. copy-on-write в s21::array).
+ *
+ * @param source Массив с данными.
+ * @param extents Размеры по каждому измерению.
+ * @param order Порядок хранения элементов.
+ * @throws std::out_of_range Если представление не помещается в массив.
+ */
+template <class T, std::size_t Rank>
+template <std::size_t Size>
+array_view<T, Rank>::array_view(array<T, Size> &source,
+                                const size_type (&extents)[Rank], layout order)
+    : array_view(nullptr, extents, order) {
+  if (size() > source.size()) {
+    throw std::out_of_range("InvalidIndexError: view is larger than array");
+  }
+  data_ = source.empty() ? nullptr : &*source.data();
+}
+
+/**
+ * @brief Доступ к элементу с проверкой границ.
+ *
+ * @return Ссылка на элемент.
+ * @throws std::out_of_range Если хотя бы один индекс выходит за свой размер.
+ */
+template <class T, std::size_t Rank>
+template <class... Indices>
+typename array_view<T, Rank>::reference array_view<T, Rank>::at(
+    Indices... indices) const {
+  static_assert(sizeof...(Indices) == Rank, "wrong number of indices");
+  const size_type index[Rank] = {static_cast<size_type>(indices)...};
+  for (size_type d = 0; d < Rank; d++) {
+    if (extents_[d] <= index[d]) {
+      throw std::out_of_range("InvalidIndexError: Index is out of range");
+    }
+  }
+  return (*this)(indices...);
+}
+
+/**
+ * @brief Возвращает общее количество элементов представления.
+ */
+template <class T, std::size_t Rank>
+typename array_view<T, Rank>::size_type array_view<T, Rank>::size() const {
+  size_type result = 1;
+  for (size_type d = 0; d < Rank; d++) result *= extents_[d];
+  return result;
+}
+
+/**
+ * @brief Проверяет, лежат ли элементы представления подряд.
+ *
+ * Представление непрерывно, если при обходе измерений от меньшего шага к
+ * большему каждый шаг равен произведению размеров предыдущих измерений.
+ */
+template <class T, std::size_t Rank>
+bool array_view<T, Rank>::is_contiguous() const {
+  bool used[Rank] = {};
+  size_type expected = 1;
+  for (size_type i = 0; i < Rank; i++) {
+    // Ищем ещё не рассмотренное измерение с наименьшим шагом
+    size_type best = Rank;
+    for (size_type d = 0; d < Rank; d++) {
+      if (!used[d] && (best == Rank || strides_[d] < strides_[best])) best = d;
+    }
+    used[best] = true;
+    if (extents_[best] > 1 && strides_[best] != expected) return false;
+    expected *= extents_[best];
+  }
+  return true;
+}
+
+/**
+ * @brief Возвращает под-блок представления.
+ *
+ * Шаги сохраняются, меняются только начало и размеры.
+ *
+ * @param offsets Начало блока по каждому измерению.
+ * @param extents Размеры блока по каждому измерению.
+ * @throws std::out_of_range Если блок выходит за границы представления.
+ */
+template <class T, std::size_t Rank>
+array_view<T, Rank> array_view<T, Rank>::subview(
+    const size_type (&offsets)[Rank], const size_type (&extents)[Rank]) const {
+  array_view result(*this);
+  for (size_type d = 0; d < Rank; d++) {
+    if (offsets[d] + extents[d] > extents_[d]) {
+      throw std::out_of_range("InvalidIndexError: Index is out of range");
+    }
+    result.data_ += offsets[d] * strides_[d];
+    result.extents_[d] = extents[d];
+  }
+  return result;
+}
+
+/**
+ * @brief Оставляет по измерению dim только каждый step-й элемент.
+ *
+ * @throws std::invalid_argument Если step равен нулю.
+ */
+template <class T, std::size_t Rank>
+array_view<T, Rank> array_view<T, Rank>::strided(size_type dim,
+                                                 size_type step) const {
+  if (step == 0) {
+    throw std::invalid_argument("step should be more than 0");
+  }
+  array_view result(*this);
+  result.extents_[dim] = (extents_[dim] + step - 1) / step;
+  result.strides_[dim] = strides_[dim] * step;
+  return result;
+}
+
+/**
+ * @brief Возвращает представление с измерениями в обратном порядке.
+ *
+ * Данные не копируются: переставляются только размеры и шаги, поэтому
+ * транспонированная матрица в row-major — это та же матрица в column-major.
+ */
+template <class T, std::size_t Rank>
+array_view<T, Rank> array_view<T, Rank>::transposed() const {
+  array_view result(*this);
+  for (size_type d = 0; d < Rank; d++) {
+    result.extents_[d] = extents_[Rank - 1 - d];
+    result.strides_[d] = strides_[Rank - 1 - d];
+  }
+  return result;
+}
+
+/**
+ * @brief Фиксирует индекс по измерению dim и возвращает представление на единицу меньшей размерности.
+ *
+ * Например, для матрицы `slice(0, i)` — это строка i, а `slice(1, j)` — столбец j.
+ *
+ * @throws std::out_of_range Если index выходит за размер измерения.
+ */
+template <class T, std::size_t Rank>
+template <std::size_t R>
+array_view<T, R - 1> array_view<T, Rank>::slice(size_type dim,
+                                                size_type index) const {
+  static_assert(R == Rank && R > 1, "slice requires at least two dimensions");
+  if (dim >= Rank || extents_[dim] <= index) {
+    throw std::out_of_range("InvalidIndexError: Index is out of range");
+  }
+  array_view<T, R - 1> result;
+  result.data_ = data_ + index * strides_[dim];
+  for (size_type d = 0, r = 0; d < Rank; d++) {
+    if (d == dim) continue;
+    result.extents_[r] = extents_[d];
+    result.strides_[r] = strides_[d];
+    r++;
+  }
+  return result;
+}
+
+/**
+ * @brief Обходит двумерное представление плитками.
+ *
+ * Плитки перебираются построчно, а внутри плитки внутренним циклом идёт
+ * измерение с меньшим шагом, чтобы доступ к памяти был последовательным.
+ *
+ * @param view Представление для обхода.
+ * @param tile_rows Высота плитки.
+ * @param tile_cols Ширина плитки.
+ * @param f Функция, вызываемая как f(i, j, view(i, j)).
+ * @throws std::invalid_argument Если размер плитки равен нулю.
+ */
+template <class T, class Function>
+void for_each_tile(const array_view<T, 2> &view, std::size_t tile_rows,
+                   std::size_t tile_cols, Function f) {
+  if (tile_rows == 0 || tile_cols == 0) {
+    throw std::invalid_argument("tile size should be more than 0");
+  }
+  const std::size_t rows = view.extent(0);
+  const std::size_t cols = view.extent(1);
+  const bool rows_inner = view.stride(0) < view.stride(1);
+  for (std::size_t ti = 0; ti < rows; ti += tile_rows) {
+    const std::size_t i_end = ti + tile_rows < rows ? ti + tile_rows : rows;
+    for (std::size_t tj = 0; tj < cols; tj += tile_cols) {
+      const std::size_t j_end = tj + tile_cols < cols ? tj + tile_cols : cols;
+      if (rows_inner) {
+        for (std::size_t j = tj; j < j_end; j++)
+          for (std::size_t i = ti; i < i_end; i++) f(i, j, view(i, j));
+      } else {
+        for (std::size_t i = ti; i < i_end; i++)
+          for (std::size_t j = tj; j < j_end; j++) f(i, j, view(i, j));
+      }
+    }
+  }
+}
+
+/**
+ * @brief Обходит двумерное представление квадратными плитками размером около 16 КБ.
+ */
+template <class T, class Function>
+void for_each_tile(const array_view<T, 2> &view, Function f) {
+  std::size_t side = static_cast<std::size_t>(std::sqrt(16384.0 / sizeof(T)));
+  if (side == 0) side = 1;
+  for_each_tile(view, side, side, f);
+}
+
+/**
+ * @brief Копирует src в dst плитками.
+ *
+ * Когда у src и dst разный порядок хранения (например, dst — транспонированное
+ * представление), построчное копирование обходило бы одно из них по столбцам
+ * и промахивалось мимо кэша на каждом элементе; плитки держат в кэше оба блока.
+ *
+ * @throws std::invalid_argument Если размеры представлений не совпадают.
+ */
+template <class T>
+void copy_tiled(const array_view<T, 2> &src, const array_view<T, 2> &dst) {
+  if (src.extent(0) != dst.extent(0) || src.extent(1) != dst.extent(1)) {
+    throw std::invalid_argument("views should have the same extents");
+  }
+  for_each_tile(src, [&dst](std::size_t i, std::size_t j, const T &value) {
+    dst(i, j) = value;
+  });
+}
+
+}  // namespace s21
@@ -0,0 +1,68 @@
+#ifndef S21_CHECK_H
+#define S21_CHECK_H
+
+#include <cassert>
+#include <stdexcept>
+
+// Политика проверки границ для operator[], front() и back() контейнеров s21.
+// Выбирается при сборке макросом S21_BOUNDS_CHECK (одинаково во всей программе):
+//   S21_CHECK_NONE   — без проверок границ: константные operator[], front() и back()
+//                      не ветвятся и объявлены noexcept. Неконстантный operator[]
+//                      s21::array и s21::soa_array сохраняет проверку copy-on-write
+//                      (при общем буфере он копирует его), поэтому noexcept не является;
+//                      в горячих циклах берите указатель data() один раз до цикла;
+//   S21_CHECK_THROW  — выход за границы бросает std::out_of_range (по умолчанию);
+//   S21_CHECK_ASSERT — проверки через assert(), а итераторы s21::list
+//                      дополнительно проверяются на разыменование end().
+// Метод at() проверяет границы всегда, независимо от политики.
+//
+// От режима зависят раскладка итераторов s21::list и поведение встроенных методов,
+// поэтому s21::list, s21::array, s21::soa_array и detail::check_bounds объявлены во
+// встроенном пространстве имён S21_BOUNDS_ABI (bounds_none, bounds_throw или
+// bounds_assert). Имя режима входит в искажённые имена символов: единицы трансляции,
+// собранные с разными режимами и передающие друг другу контейнеры, не слинкуются,
+// вместо молчаливого нарушения ODR.
+#define S21_CHECK_NONE 0
+#define S21_CHECK_THROW 1
+#define S21_CHECK_ASSERT 2
+
+#ifndef S21_BOUNDS_CHECK
+#define S21_BOUNDS_CHECK S21_CHECK_THROW
+#endif
+
+#if S21_BOUNDS_CHECK == S21_CHECK_NONE
+#define S21_BOUNDS_ABI bounds_none
+#elif S21_BOUNDS_CHECK == S21_CHECK_THROW
+#define S21_BOUNDS_ABI bounds_throw
+#elif S21_BOUNDS_CHECK == S21_CHECK_ASSERT
+#define S21_BOUNDS_ABI bounds_assert
+#else
+#error "S21_BOUNDS_CHECK must be S21_CHECK_NONE, S21_CHECK_THROW or S21_CHECK_ASSERT"
+#endif
+
+// Спецификатор для методов, которые бросают исключение только в режиме S21_CHECK_THROW
+#define S21_CHECKED_NOEXCEPT noexcept(S21_BOUNDS_CHECK != S21_CHECK_THROW)
+
+namespace s21 {
+namespace detail {
+inline namespace S21_BOUNDS_ABI {
+
+// Проверка условия согласно выбранной политике
+inline void check_bounds(bool valid, const char *message) S21_CHECKED_NOEXCEPT {
+#if S21_BOUNDS_CHECK == S21_CHECK_THROW
+  if (!valid) throw std::out_of_range(message);
+#elif S21_BOUNDS_CHECK == S21_CHECK_ASSERT
+  assert(valid && message);
+  (void)valid;
+  (void)message;
+#else
+  (void)valid;
+  (void)message;
+#endif
+}
+
+}  // inline namespace S21_BOUNDS_ABI
+}  // namespace detail
+}  // namespace s21
+
+#endif  // S21_CHECK_H
@@ -0,0 +1,57 @@
+#ifndef S21_EXTERNAL_SORT_H
+#define S21_EXTERNAL_SORT_H
+
+#include <cstddef>
+#include <string>
+
+#include "s21_list.h"
+
+namespace s21 {
+
+// Параметры внешней сортировки
+struct external_sort_options {
+  // Сколько памяти (в байтах) можно занять под прогоны в памяти. Половина
+  // отдаётся прогону, который заполняется и сортируется, половина — прогону,
+  // который в это время пишется на диск в фоновом потоке.
+  std::size_t memory_budget = std::size_t(64) << 20;
+  // Каталог для временных файлов; пустая строка — системный временный каталог
+  std::string temp_dir;
+  // Сколько прогонов сливается за один проход (ограничение на открытые файлы)
+  std::size_t merge_fan_in = 256;
+};
+
+// Внешняя сортировка слиянием для данных, которые не помещаются в память.
+//
+// source — функция bool(T&): записывает очередной элемент и возвращает false,
+// когда данные закончились. Элементы набираются в s21::list порциями в рамках
+// бюджета памяти, каждая порция сортируется list::sort() и сбрасывается во
+// временный файл (прогон) в двоичном формате, пока следующая порция уже
+// набирается и сортируется. Затем прогоны сливаются k-путевым слиянием на
+// двоичной куче, и элементы по возрастанию передаются в sink — функцию
+// void(const T&). Сортировка устойчивая. Если все данные уместились в один
+// прогон, временные файлы не создаются.
+//
+// С вычислениями перекрывается только запись прогонов в первой фазе. При
+// слиянии чтение прогонов и запись промежуточных прогонов синхронны: каждый
+// прогон читается блоками по memory_budget / (merge_fan_in + 1) байт, и
+// пока блок читается, слияние стоит. На медленном диске время слияния
+// ограничено суммой задержек чтения; больший memory_budget или меньший
+// merge_fan_in уменьшают число обращений.
+//
+// T должен быть тривиально копируемым: прогоны хранят его побайтово.
+// Бросает std::runtime_error при ошибках ввода-вывода; временные файлы
+// удаляются в любом случае.
+template <class T, class Source, class Sink>
+void external_sort(Source source, Sink sink,
+                   const external_sort_options& options = external_sort_options());
+
+// То же, но результат собирается в s21::list.
+template <class T, class Source>
+list<T> external_sort(Source source,
+                      const external_sort_options& options = external_sort_options());
+
+}  // namespace s21
+
+#include "s21_external_sort.tpp"
+
+#endif  // S21_EXTERNAL_SORT_H
@@ -0,0 +1,267 @@
+#include <unistd.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <queue>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "s21_external_sort.h"
+
+namespace s21 {
+namespace detail {
+
+// Заголовок файла прогона: сигнатура, размер записи и количество записей.
+// Дальше подряд идут записи по sizeof(T) байт в порядке сортировки.
+struct run_header {
+  char magic_[8];
+  std::uint64_t record_size_;
+  std::uint64_t count_;
+};
+
+constexpr char run_magic[8] = {'S', '2', '1', 'R', 'U', 'N', '0', '1'};
+
+// Набор временных файлов прогонов. Удаляет свои файлы в деструкторе, поэтому
+// при исключении на диске ничего не остаётся.
+class run_files {
+ public:
+  explicit run_files(const external_sort_options& options) {
+    directory_ = options.temp_dir.empty()
+                     ? std::filesystem::temp_directory_path()
+                     : std::filesystem::path(options.temp_dir);
+    // Номер процесса и счётчик сортировок в процессе: имена не совпадают ни у
+    // параллельных сортировок, ни у сортировок в разных процессах
+    prefix_ = "s21_run_" + std::to_string(::getpid()) + "_" +
+              std::to_string(next_id_.fetch_add(1, std::memory_order_relaxed));
+  }
+  run_files(const run_files&) = delete;
+  run_files& operator=(const run_files&) = delete;
+  ~run_files() {
+    std::error_code ignored;
+    for (const std::string& path : created_) std::filesystem::remove(path, ignored);
+  }
+
+  // Имя нового временного файла
+  std::string create() {
+    std::string path =
+        (directory_ / (prefix_ + "_" + std::to_string(created_.size()) + ".bin")).string();
+    created_.push_back(path);
+    return path;
+  }
+
+  // Удаляет файл, который больше не нужен
+  void remove(const std::string& path) {
+    std::error_code ignored;
+    std::filesystem::remove(path, ignored);
+  }
+
+ private:
+  std::filesystem::path directory_;
+  std::string prefix_;
+  std::vector<std::string> created_;
+  static inline std::atomic<unsigned long> next_id_{0};
+};
+
+// Последовательная запись прогона с буферизацией потока.
+template <class T>
+class run_writer {
+ public:
+  explicit run_writer(const std::string& path)
+      : out_(path, std::ios::binary | std::ios::trunc) {
+    if (!out_) throw std::runtime_error("external_sort: cannot create " + path);
+    run_header header;
+    std::memcpy(header.magic_, run_magic, sizeof(run_magic));
+    header.record_size_ = sizeof(T);
+    header.count_ = 0;
+    out_.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  }
+
+  void operator()(const T& value) {
+    out_.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    count_++;
+  }
+
+  // Дописывает количество записей в заголовок и проверяет, что всё записано
+  void finish() {
+    out_.seekp(offsetof(run_header, count_));
+    out_.write(reinterpret_cast<const char*>(&count_), sizeof(count_));
+    out_.flush();
+    if (!out_) throw std::runtime_error("external_sort: write failed");
+  }
+
+ private:
+  std::ofstream out_;
+  std::uint64_t count_ = 0;
+};
+
+// Чтение прогона блоками по buffer_records записей.
+template <class T>
+class run_reader {
+ public:
+  run_reader(const std::string& path, std::size_t buffer_records)
+      : in_(path, std::ios::binary), buffer_(buffer_records ? buffer_records : 1) {
+    run_header header;
+    in_.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!in_ || std::memcmp(header.magic_, run_magic, sizeof(run_magic)) != 0 ||
+        header.record_size_ != sizeof(T)) {
+      throw std::runtime_error("external_sort: bad run file " + path);
+    }
+    left_ = header.count_;
+  }
+
+  // Записывает очередной элемент в value; false — прогон закончился
+  bool next(T& value) {
+    if (pos_ == filled_) {
+      if (left_ == 0) return false;
+      filled_ = left_ < buffer_.size() ? left_ : buffer_.size();
+      in_.read(reinterpret_cast<char*>(buffer_.data()), filled_ * sizeof(T));
+      if (!in_) throw std::runtime_error("external_sort: read failed");
+      left_ -= filled_;
+      pos_ = 0;
+    }
+    value = buffer_[pos_++];
+    return true;
+  }
+
+ private:
+  std::ifstream in_;
+  std::vector<T> buffer_;
+  std::uint64_t left_ = 0;
+  std::size_t filled_ = 0;
+  std::size_t pos_ = 0;
+};
+
+// k-путевое слияние прогонов paths[first, last) на двоичной куче.
+// При равных значениях первым выходит элемент из прогона с меньшим номером,
+// так что слияние сохраняет устойчивость сортировки.
+template <class T, class Sink>
+void merge_runs(const std::vector<std::string>& paths, std::size_t first,
+                std::size_t last, std::size_t buffer_records, Sink& sink) {
+  std::vector<run_reader<T>> readers;
+  readers.reserve(last - first);
+  for (std::size_t i = first; i < last; i++) readers.emplace_back(paths[i], buffer_records);
+
+  using entry = std::pair<T, std::size_t>;
+  auto later = [](const entry& a, const entry& b) {
+    return b.first < a.first || (!(a.first < b.first) && b.second < a.second);
+  };
+  std::priority_queue<entry, std::vector<entry>, decltype(later)> heap(later);
+  T value;
+  for (std::size_t i = 0; i < readers.size(); i++) {
+    if (readers[i].next(value)) heap.emplace(value, i);
+  }
+  while (!heap.empty()) {
+    entry top = heap.top();
+    heap.pop();
+    sink(top.first);
+    if (readers[top.second].next(value)) heap.emplace(value, top.second);
+  }
+}
+
+// Записывает отсортированный список в новый прогон. Если запись не удалась,
+// недописанный файл удаляется сразу, в том же фоновом потоке.
+template <class T>
+void write_run(list<T>& run, const std::string& path) {
+  try {
+    run_writer<T> writer(path);
+    for (typename list<T>::iterator it = run.begin(); it != run.end(); ++it) writer(*it);
+    writer.finish();
+  } catch (...) {
+    std::error_code ignored;
+    std::filesystem::remove(path, ignored);
+    throw;
+  }
+}
+
+}  // namespace detail
+
+template <class T, class Source, class Sink>
+void external_sort(Source source, Sink sink,
+                   const external_sort_options& options) {
+  static_assert(std::is_trivially_copyable<T>::value,
+                "external_sort stores elements bytewise and needs a trivially "
+                "copyable type");
+
+  // Узел списка — значение и два указателя; в памяти одновременно два прогона
+  const std::size_t node_bytes = sizeof(T) + 2 * sizeof(void*);
+  std::size_t run_capacity = options.memory_budget / 2 / node_bytes;
+  if (run_capacity == 0) run_capacity = 1;
+  const std::size_t fan_in = options.merge_fan_in < 2 ? 2 : options.merge_fan_in;
+
+  detail::run_files files(options);
+  std::vector<std::string> runs;
+  list<T> filling;  // Прогон, который набирается и сортируется
+  list<T> writing;  // Прогон, который пишется на диск в фоновом потоке
+  std::future<void> pending;
+  bool more = true;
+  T value;
+
+  // Фаза 1: нарезка на отсортированные прогоны
+  while (more) {
+    filling.clear();
+    std::size_t count = 0;
+    while (count < run_capacity && (more = source(value))) {
+      filling.insert(filling.end(), value);
+      count++;
+    }
+    if (count == 0) break;
+    filling.sort();
+
+    // Всё уместилось в память: диск не нужен
+    if (!more && runs.empty()) {
+      for (typename list<T>::iterator it = filling.begin(); it != filling.end(); ++it) {
+        sink(*it);
+      }
+      return;
+    }
+
+    // Ждём окончания записи предыдущего прогона и отдаём ему текущий
+    if (pending.valid()) pending.get();
+    filling.swap(writing);
+    runs.push_back(files.create());
+    pending = std::async(std::launch::async, detail::write_run<T>,
+                         std::ref(writing), runs.back());
+  }
+  if (pending.valid()) pending.get();
+  filling.clear();
+  writing.clear();
+
+  // Буфер чтения на каждый из сливаемых прогонов в рамках бюджета
+  const std::size_t buffer_records =
+      options.memory_budget / (fan_in + 1) / sizeof(T);
+
+  // Фаза 2: промежуточные проходы, пока прогонов больше, чем fan_in
+  while (runs.size() > fan_in) {
+    std::vector<std::string> merged;
+    for (std::size_t first = 0; first < runs.size(); first += fan_in) {
+      std::size_t last = first + fan_in < runs.size() ? first + fan_in : runs.size();
+      merged.push_back(files.create());
+      detail::run_writer<T> writer(merged.back());
+      detail::merge_runs<T>(runs, first, last, buffer_records, writer);
+      writer.finish();
+      for (std::size_t i = first; i < last; i++) files.remove(runs[i]);
+    }
+    runs.swap(merged);
+  }
+
+  // Фаза 3: финальное слияние прямо в sink
+  detail::merge_runs<T>(runs, 0, runs.size(), buffer_records, sink);
+}
+
+template <class T, class Source>
+list<T> external_sort(Source source, const external_sort_options& options) {
+  list<T> result;
+  external_sort<T>(
+      source, [&result](const T& value) { result.insert(result.end(), value); },
+      options);
+  return result;
+}
+
+}  // namespace s21
@@ -1,12 +1,28 @@
 #ifndef S21_LIST_H
 #define S21_LIST_H
 
+#include <functional>
 #include <initializer_list>
 #include <iostream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "s21_check.h"
+#include "s21_radix_sort.h"
 
 using namespace std;
 
 namespace s21 {
+namespace detail {
+struct list_access;  // Доступ к узлам списка для s21::merge_all (s21_merge_all.h)
+}  // namespace detail
+
+inline namespace S21_BOUNDS_ABI {
+
 // Определение шаблона класса list, который представляет собой двусвязный список
 template <class T>
 class list {
@@ -26,32 +42,56 @@ class list {
     // Конструктор для инициализации значения узла
     node(const value_type& value)
         : value_(value), next_(nullptr), prev_(nullptr) {}
+    // Конструктор, перемещающий значение в узел (используется в relayout)
+    node(value_type&& value)
+        : value_(std::move(value)), next_(nullptr), prev_(nullptr) {}
   };
 
   size_type size_ = 0;  // Размер списка (количество элементов)
   node* head_ = nullptr;  // Указатель на первый элемент списка
   node* tail_ = nullptr;  // Указатель на последний элемент списка
   node* size_node_ = nullptr;  // Указатель на вспомогательный узел для хранения размера списка
+  node* arena_ = nullptr;  // Непрерывный блок узлов, созданный relayout()
+  size_type arena_capacity_ = 0;  // Количество узлов в блоке arena_
+  size_type arena_live_ = 0;  // Количество ещё не удалённых узлов блока arena_
+
+  friend struct detail::list_access;
+
+  void destroy_node(node* ptr);  // Удаление узла (из кучи или из блока arena_)
+  std::pair<node*, node*> release_nodes();  // Передача всех узлов наружу; список становится пустым
+  void adopt_nodes(node* first, node* last, size_type count);  // Приём готовой двусвязной цепочки узлов
+  // Предвыборка узла, следующего за соседним (включается макросом S21_LIST_PREFETCH)
+  static void prefetch_ahead(const node* ptr) {
+#ifdef S21_LIST_PREFETCH
+    if (ptr && ptr->next_) __builtin_prefetch(ptr->next_->next_);
+#else
+    (void)ptr;
+#endif
+  }
 
  public:
   // Определение итераторов для обхода списка
   class listIterator {
    private:
     node* ptr_ = nullptr;  // Указатель на текущий узел
+#if S21_BOUNDS_CHECK == S21_CHECK_ASSERT
+    const node* end_ = nullptr;  // Служебный узел списка, разыменовывать который нельзя
+    listIterator(node* ptr, const node* end) noexcept : ptr_(ptr), end_(end) {}
+#endif
     friend class list<value_type>;  // Друзьям класса разрешено доступать к приватным данным
 
    public:
-    listIterator();  // Конструктор по умолчанию
-    listIterator(node* ptr);  // Конструктор с указателем на узел
-    listIterator& operator++();    // Префиксная операция инкремента (перемещение на следующий элемент)
-    listIterator operator++(int);  // Постфиксная операция инкремента
-    listIterator& operator--();    // Префиксная операция декремента (перемещение на предыдущий элемент)
-    listIterator operator--(int);  // Постфиксная операция декремента
-    listIterator operator-(size_type value);  // Операция вычитания для перемещения итератора
+    listIterator() noexcept;  // Конструктор по умолчанию
+    listIterator(node* ptr) noexcept;  // Конструктор с указателем на узел
+    listIterator& operator++() S21_CHECKED_NOEXCEPT;    // Префиксная операция инкремента (перемещение на следующий элемент)
+    listIterator operator++(int) S21_CHECKED_NOEXCEPT;  // Постфиксная операция инкремента
+    listIterator& operator--() noexcept;    // Префиксная операция декремента (перемещение на предыдущий элемент)
+    listIterator operator--(int) noexcept;  // Постфиксная операция декремента
+    listIterator operator-(size_type value) noexcept;  // Операция вычитания для перемещения итератора
     value_type operator*() const;  // Операция разыменования (доступ к значению)
     value_type operator->() const;  // Операция доступа к члену элемента
-    bool operator==(listIterator other);  // Операция сравнения итераторов на равенство
-    bool operator!=(listIterator other);  // Операция сравнения итераторов на неравенство
+    bool operator==(listIterator other) noexcept;  // Операция сравнения итераторов на равенство
+    bool operator!=(listIterator other) noexcept;  // Операция сравнения итераторов на неравенство
   };
 
   // Константный итератор, который расширяет функциональность обычного итератора, запрещая изменение значений
@@ -61,9 +101,83 @@ class list {
     const_reference operator*();  // Разыменование в константном итераторе, возвращает константную ссылку
   };
 
+  // Итератор для обхода списка от конца к началу по указателям prev_
+  class listReverseIterator {
+   private:
+    node* ptr_ = nullptr;  // Указатель на текущий узел
+    friend class list<T>;
+
+   public:
+    // Характеристики итератора для алгоритмов стандартной библиотеки
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T*;
+    using reference = T&;
+
+    listReverseIterator() noexcept;  // Конструктор по умолчанию
+    explicit listReverseIterator(node* ptr) noexcept;  // Конструктор с указателем на узел
+    listReverseIterator& operator++() noexcept;    // Переход к предыдущему элементу списка
+    listReverseIterator operator++(int) noexcept;  // Постфиксный переход к предыдущему элементу
+    listReverseIterator& operator--() noexcept;    // Переход к следующему элементу списка
+    listReverseIterator operator--(int) noexcept;  // Постфиксный переход к следующему элементу
+    reference operator*() const noexcept;  // Доступ к значению текущего узла
+    pointer operator->() const noexcept;   // Доступ к члену значения текущего узла
+    bool operator==(const listReverseIterator& other) const noexcept;
+    bool operator!=(const listReverseIterator& other) const noexcept;
+  };
+
+  // Обратный итератор константного списка: значения доступны только для чтения
+  class listConstReverseIterator {
+   private:
+    const node* ptr_ = nullptr;  // Указатель на текущий узел
+    friend class list<T>;
+
+   public:
+    // Характеристики итератора для алгоритмов стандартной библиотеки
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T*;
+    using reference = const T&;
+
+    listConstReverseIterator() noexcept;  // Конструктор по умолчанию
+    explicit listConstReverseIterator(const node* ptr) noexcept;  // Конструктор с указателем на узел
+    listConstReverseIterator(listReverseIterator other) noexcept;  // Преобразование из изменяемого итератора
+    listConstReverseIterator& operator++() noexcept;    // Переход к предыдущему элементу списка
+    listConstReverseIterator operator++(int) noexcept;  // Постфиксный переход к предыдущему элементу
+    listConstReverseIterator& operator--() noexcept;    // Переход к следующему элементу списка
+    listConstReverseIterator operator--(int) noexcept;  // Постфиксный переход к следующему элементу
+    reference operator*() const noexcept;  // Доступ к значению текущего узла
+    pointer operator->() const noexcept;   // Доступ к члену значения текущего узла
+    bool operator==(const listConstReverseIterator& other) const noexcept;
+    bool operator!=(const listConstReverseIterator& other) const noexcept;
+  };
+
+  // Представление списка в обратном порядке. Ничего не копирует и не меняет
+  // связи узлов, поэтому создаётся за O(1); действительно, пока жив список.
+  // Для константного списка List = const list, и обход идёт по константным
+  // обратным итераторам.
+  template <class List, class Iterator>
+  class basic_reversed_view {
+   private:
+    List* list_;  // Список, который обходится с конца
+
+   public:
+    explicit basic_reversed_view(List& source) noexcept : list_(&source) {}
+    Iterator begin() const noexcept { return list_->rbegin(); }
+    Iterator end() const noexcept { return list_->rend(); }
+    size_type size() const noexcept { return list_->size(); }
+    bool empty() const noexcept { return list_->empty(); }
+  };
+
   // Псевдонимы для типов итераторов
   using iterator = listIterator;
   using const_iterator = listConstIterator;
+  using reverse_iterator = listReverseIterator;
+  using const_reverse_iterator = listConstReverseIterator;
+  using reversed_view = basic_reversed_view<list, reverse_iterator>;
+  using const_reversed_view = basic_reversed_view<const list, const_reverse_iterator>;
 
  public:
   // Функции для работы с размером списка
@@ -72,18 +186,26 @@ class list {
   list(size_type n);  // Конструктор с размером
   list(std::initializer_list<value_type> const& items);  // Конструктор для инициализации из списка
   list(const list& l);  // Конструктор копирования
-  list(list&& l);  // Конструктор перемещения
+  list(list&& l) noexcept;  // Конструктор перемещения
   ~list();  // Деструктор
 
   // Операторы присваивания и другие функции
-  list& operator=(list&& l);  // Оператор перемещения
-  const_reference front();  // Получение первого элемента
-  const_reference back();  // Получение последнего элемента
-  iterator begin();  // Получение итератора на первый элемент
-  iterator end();  // Получение итератора на элемент после последнего
-  bool empty();  // Проверка, пуст ли список
-  size_type size();  // Возвращает размер списка
-  size_type max_size();  // Максимальный размер списка
+  list& operator=(list&& l) noexcept;  // Оператор перемещения
+  const_reference front() const S21_CHECKED_NOEXCEPT;  // Получение первого элемента
+  const_reference back() const S21_CHECKED_NOEXCEPT;  // Получение последнего элемента
+  iterator begin() noexcept;  // Получение итератора на первый элемент
+  iterator end() noexcept;  // Получение итератора на элемент после последнего
+  reverse_iterator rbegin() noexcept;  // Итератор на последний элемент для обхода с конца
+  reverse_iterator rend() noexcept;  // Итератор на позицию перед первым элементом
+  const_reverse_iterator rbegin() const noexcept;  // Константный итератор на последний элемент
+  const_reverse_iterator rend() const noexcept;  // Константный итератор перед первым элементом
+  const_reverse_iterator crbegin() const noexcept;  // То же, что rbegin() const
+  const_reverse_iterator crend() const noexcept;  // То же, что rend() const
+  reversed_view reversed() noexcept;  // Обход списка с конца без изменения связей, O(1)
+  const_reversed_view reversed() const noexcept;  // Обход константного списка с конца, O(1)
+  bool empty() const noexcept;  // Проверка, пуст ли список
+  size_type size() const noexcept;  // Возвращает размер списка
+  size_type max_size() const noexcept;  // Максимальный размер списка
   void clear();  // Очистка списка
 
   // Функции для доступа и модификации элементов
@@ -95,17 +217,37 @@ class list {
   void pop_back();  // Удаление последнего элемента
   void push_front(const_reference value);  // Добавление элемента в начало списка
   void pop_front();  // Удаление первого элемента
-  void swap(list& other);  // Обмен содержимым двух списков
+  void swap(list& other) noexcept;  // Обмен содержимым двух списков
   void merge(list& other);  // Слияние двух отсортированных списков
   void splice(const_iterator pos, list& other);  // Перемещение элементов другого списка в текущий
   void reverse();  // Реверс списка
   void unique();  // Удаление повторяющихся элементов
-  void sort();  // Сортировка списка
+  // Сортировка списка (устойчивая). Итераторы остаются действительными, но
+  // то, на что они указывают после сортировки, зависит от типа элементов:
+  //  - целые, float и double при size() > 64 сортируются поразрядно по
+  //    значениям: значения переписываются в узлы, узлы остаются на месте,
+  //    поэтому итератор остаётся на своей позиции и видит другое значение
+  //    (для list<int> *it после sort() — это уже не тот элемент, что до неё);
+  //  - остальные типы (и короткие списки) сортируются слиянием с перешивкой
+  //    узлов: итератор следует за своим элементом (для list<Record> *it не
+  //    меняется, меняется лишь его позиция).
+  // Если нужна перешивка узлов и для чисел, используйте sort_by_key.
+  void sort();
+  // Поразрядная сортировка по арифметическому ключу key_fn(value). Всегда
+  // перешивает узлы, так что итераторы следуют за своими элементами.
+  template <class KeyFn>
+  void sort_by_key(KeyFn key_fn);
+  void relayout();  // Перенос всех узлов в один непрерывный блок в порядке списка
   void quick_sort(iterator first, iterator last);  // Быстрая сортировка
   iterator partition(iterator first, iterator last);  // Разделение списка для быстрой сортировки
   node* merge_nodes(node* left_part, node* right_part);  // Слияние двух отсортированных частей
+  void relink_chain(node* first);  // Восстановление prev_, head_ и tail_ по цепочке next_
+  template <class KeyFn>
+  void radix_sort_nodes(KeyFn key_fn);  // Поразрядная сортировка массива указателей на узлы
+  void radix_sort_values();  // Поразрядная сортировка значений арифметического типа
   void delete_size_node();  // Удаление вспомогательного узла для хранения размера списка
 };
+}  // inline namespace S21_BOUNDS_ABI
 }  // namespace s21
 
 #include "s21_list.tpp"  // Подключение реализации шаблонных функций
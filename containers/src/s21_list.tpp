@@ -1,6 +1,7 @@
 #include "s21_list.h"
 
 namespace s21 {
+inline namespace S21_BOUNDS_ABI {
 
 // Функция-член set_size_node класса list
 // Данная функция обновляет специальный узел `size_node_` следующим образом:
@@ -8,9 +9,14 @@ namespace s21 {
 // - Настраивает поля `next_` и `prev_` узла `size_node_`, чтобы они указывали на голову (head_) и хвост (tail_) списка соответственно.
 // - Если голова списка (head_) не пуста, то поле `prev_` головы обновляется, чтобы указывать на `size_node_`.
 // - Если хвост списка (tail_) не пуст, то поле `next_` хвоста обновляется, чтобы указывать на `size_node_`.
+// - Если узла `size_node_` ещё нет (конструктор копирования), он создаётся здесь.
 
 template <typename T>
 void list<T>::set_size_node() {
+  if (!size_node_) {
+    size_node_ = new node(size_);
+  }
+
   // Устанавливаем значение количества элементов списка в поле value_ узла size_node_
   size_node_->value_ = size(); 
 
@@ -150,36 +156,32 @@ list<T>::list(const list& l)
     l_curr_node = l_curr_node->next_;  // Переходим к следующему узлу в исходном списке
   }
 
-  // Примечание: Узел size_node_ не создаётся в данном коде.
-  // Если узел size_node_ нужен, его создание и настройка должны быть добавлены.
+  // Создаём и связываем служебный узел size_node_
+  set_size_node();
 }
 
 // Конструктор перемещения класса list
-// Этот конструктор переносит содержимое списка `l` в новый список, оставляя `l` в пустом состоянии.
-// Это позволяет избежать лишнего копирования данных и повысить производительность.
+// Этот конструктор забирает узлы списка `l` вместе со служебным узлом, не копируя
+// элементов, поэтому он noexcept: std::vector<list<T>> при перераспределении
+// перемещает списки, а не копирует их.
+// Список `l` остаётся пустым и без служебного узла: конструктор ничего не выделяет.
+// Пустым списком без служебного узла можно пользоваться как обычным (begin() == end(),
+// insert, merge, splice) — узел заводится лениво при первой вставке.
 
 template <typename T>
-list<T>::list(list&& l)
-    : size_(0),            // Инициализируем размер нового списка как 0
-      head_(nullptr),      // Устанавливаем указатель на голову нового списка как nullptr
-      tail_(nullptr),      // Устанавливаем указатель на хвост нового списка как nullptr
-      size_node_(nullptr)  // Инициализируем указатель на специальный узел `size_node_` как nullptr
-{
-  // Указатель для итерации по узлам списка `l`
-  node* l_curr_node = l.head_;
-
-  // Удаляем все существующие элементы в текущем (новом) списке, если таковые имеются
-  clear();
-
-  // Переносим все узлы из списка `l` в текущий список
-  for (size_type i = 0; i < l.size_; i++) {
-    push_back(l_curr_node->value_);  // Добавляем значение текущего узла в конец нового списка
-    l_curr_node = l_curr_node->next_;  // Переходим к следующему узлу в списке `l`
-  }
-
+list<T>::list(list&& l) noexcept
+    : size_(l.size_),
+      head_(l.head_),
+      tail_(l.tail_),
+      size_node_(l.size_node_),
+      arena_(l.arena_),
+      arena_capacity_(l.arena_capacity_),
+      arena_live_(l.arena_live_) {
   // Обнуляем данные в списке `l`, так как он теперь перемещён
   l.size_ = 0;
-  l.head_ = l.tail_ = nullptr;
+  l.head_ = l.tail_ = l.arena_ = nullptr;
+  l.arena_capacity_ = l.arena_live_ = 0;
+  l.size_node_ = nullptr;
 }
 
 // Деструктор класса list
@@ -204,20 +206,11 @@ list<T>::~list() {
 // Возвращает:
 // - Ссылку на текущий объект (*this) для обеспечения цепочки вызовов.
 template <typename T>
-list<T>& list<T>::operator=(list&& l) {
-  // Удаляем текущие элементы списка, чтобы освободить память и подготовить объект к переносу новых данных.
-  while (!empty()) {
-    pop_back();
-  }
-
-  // Инициализируем временный указатель на голову перемещаемого списка.
-  node* l_curr_node = l.head_;
-
-  // Перемещаем элементы из списка `l` в текущий список.
-  for (size_type i = 0; i < l.size_; i++) {
-    push_back(l_curr_node->value_);
-    l_curr_node = l_curr_node->next_;
-  }
+list<T>& list<T>::operator=(list&& l) noexcept {
+  // Забираем узлы `l` во временный список и обмениваемся с ним:
+  // прежние узлы текущего списка удалит деструктор временного.
+  list temp(std::move(l));
+  swap(temp);
 
   // Возвращаем текущий объект для поддержки цепочки вызовов.
   return *this;
@@ -225,52 +218,112 @@ list<T>& list<T>::operator=(list&& l) {
 
 
 // Возвращает значение первого элемента списка.
-// Предполагается, что список не пуст, поэтому доступ осуществляется напрямую через head_.
-// Если список пуст, поведение неопределено.
+// Пустой список проверяется согласно политике S21_BOUNDS_CHECK (см. s21_check.h):
+// по умолчанию бросается std::out_of_range, в режиме S21_CHECK_NONE проверки нет.
 template <typename T>
-typename list<T>::const_reference list<T>::front() {
+typename list<T>::const_reference list<T>::front() const S21_CHECKED_NOEXCEPT {
+  detail::check_bounds(head_ != nullptr, "list is empty");
   return head_->value_;  // Возвращаем значение узла, на который указывает head_.
 }
 
 // Возвращает значение последнего элемента списка.
-// Аналогично front(), предполагается, что список не пуст.
+// Аналогично front(), пустой список проверяется согласно политике S21_BOUNDS_CHECK.
 template <typename T>
-typename list<T>::const_reference list<T>::back() {
+typename list<T>::const_reference list<T>::back() const S21_CHECKED_NOEXCEPT {
+  detail::check_bounds(tail_ != nullptr, "list is empty");
   return tail_->value_;  // Возвращаем значение узла, на который указывает tail_.
 }
 
 // Возвращает итератор, указывающий на первый элемент списка.
-// Если список пуст, возвращается итератор, указывающий на size_node_ (служебный узел).
+// Если список пуст, возвращается итератор, указывающий на size_node_ (служебный узел);
+// у перемещённого списка, где служебного узла ещё нет, begin() == end() == nullptr.
 template <typename T>
-typename list<T>::iterator list<T>::begin() {
+typename list<T>::iterator list<T>::begin() noexcept {
+#if S21_BOUNDS_CHECK == S21_CHECK_ASSERT
+  return iterator(head_ ? head_ : size_node_, size_node_);
+#else
   return head_ ? iterator(head_) : iterator(size_node_);  // Итератор на head_ или size_node_.
+#endif
 }
 
 // Возвращает итератор, указывающий на конец списка (size_node_).
 // Итератор end() используется для обозначения границы за последним элементом.
 template <typename T>
-typename list<T>::iterator list<T>::end() {
+typename list<T>::iterator list<T>::end() noexcept {
+#if S21_BOUNDS_CHECK == S21_CHECK_ASSERT
+  return iterator(size_node_, size_node_);
+#else
   return iterator(size_node_);  // Итератор на служебный узел size_node_.
+#endif
+}
+
+// Возвращает обратный итератор на последний элемент списка.
+// Если список пуст, итератор указывает на служебный узел и совпадает с rend().
+template <typename T>
+typename list<T>::reverse_iterator list<T>::rbegin() noexcept {
+  return reverse_iterator(tail_ ? tail_ : size_node_);
+}
+
+// Возвращает обратный итератор на позицию перед первым элементом.
+// Служебный узел связан с головой и хвостом, поэтому обратный обход
+// останавливается на нём так же, как прямой.
+template <typename T>
+typename list<T>::reverse_iterator list<T>::rend() noexcept {
+  return reverse_iterator(size_node_);
+}
+
+// Возвращает представление списка в обратном порядке: for (auto& x : l.reversed())
+// обходит элементы с конца за O(1) на подготовку, не трогая связи узлов.
+// В отличие от reverse(), сам список не меняется.
+template <typename T>
+typename list<T>::reversed_view list<T>::reversed() noexcept {
+  return reversed_view(*this);
+}
+
+// Константные варианты обратного обхода: значения доступны только для чтения.
+template <typename T>
+typename list<T>::const_reverse_iterator list<T>::rbegin() const noexcept {
+  return const_reverse_iterator(tail_ ? tail_ : size_node_);
+}
+
+template <typename T>
+typename list<T>::const_reverse_iterator list<T>::rend() const noexcept {
+  return const_reverse_iterator(size_node_);
+}
+
+template <typename T>
+typename list<T>::const_reverse_iterator list<T>::crbegin() const noexcept {
+  return rbegin();
+}
+
+template <typename T>
+typename list<T>::const_reverse_iterator list<T>::crend() const noexcept {
+  return rend();
+}
+
+template <typename T>
+typename list<T>::const_reversed_view list<T>::reversed() const noexcept {
+  return const_reversed_view(*this);
 }
 
 // Проверяет, пуст ли список.
 // Возвращает true, если head_ равен nullptr (нет элементов в списке).
 template <typename T>
-bool list<T>::empty() {
+bool list<T>::empty() const noexcept {
   return (this->head_ == nullptr);  // Список пуст, если нет указателя на первый элемент.
 }
 
 // Возвращает количество элементов в списке.
 // Значение хранится в переменной size_ и поддерживается актуальным.
 template <typename T>
-typename list<T>::size_type list<T>::size() {
+typename list<T>::size_type list<T>::size() const noexcept {
   return size_;  // Возвращаем количество узлов.
 }
 
 // Возвращает максимально возможное количество элементов в списке.
 // Значение основано на максимально возможном размере типа size_type и размере узла.
 template <typename T>
-typename list<T>::size_type list<T>::max_size() {
+typename list<T>::size_type list<T>::max_size() const noexcept {
   return numeric_limits<size_type>::max() / sizeof(node);  // Рассчитываем максимум по памяти.
 }
 
@@ -327,12 +380,16 @@ typename list<T>::node* list<T>::operator[](list<T>::value_type index) {
 template <typename T>
 typename list<T>::iterator list<T>::insert(list<T>::iterator pos,
                                            list<T>::const_reference value) {
+  // Перемещённый список ещё не имеет служебного узла: заводим его до нового узла,
+  // чтобы при нехватке памяти список остался прежним.
+  if (!size_node_) set_size_node();
+
   // Создаем новый узел со значением value.
   node* new_node = new node(value);
 
   // Указатели на текущий узел (pos.ptr_) и его предыдущий узел.
-  node* current = pos.ptr_;
-  node* prev = current->prev_;
+  // Итератор end(), полученный до появления служебного узла, хранит nullptr.
+  node* current = pos.ptr_ ? pos.ptr_ : size_node_;
 
   // Если список пустой, новый узел становится и головой, и хвостом.
   if (empty()) {
@@ -349,6 +406,7 @@ typename list<T>::iterator list<T>::insert(list<T>::iterator pos,
     else if (current == size_node_) {
       tail_ = new_node;
     }
+    node* prev = current->prev_;
 
     // Обновляем указатели соседних узлов:
     // Предыдущий узел теперь указывает на новый узел.
@@ -371,7 +429,11 @@ typename list<T>::iterator list<T>::insert(list<T>::iterator pos,
   set_size_node();
 
   // Возвращаем итератор на только что вставленный узел.
+#if S21_BOUNDS_CHECK == S21_CHECK_ASSERT
+  return iterator(new_node, size_node_);
+#else
   return iterator(new_node);
+#endif
 }
 
 
@@ -383,29 +445,18 @@ void list<T>::erase(list<T>::iterator pos) {
   node* current = pos.ptr_;
 
   // Проверка на пустоту списка или на попытку удалить узел, который не существует (size_node_).
-  if (empty() || current == size_node_) {
+  if (empty() || current == size_node_ || current == nullptr) {
     throw invalid_argument("invalid argument");
   }
 
-  // Если удаляемый узел - это голова списка.
+  // Если удаляемый узел - это голова списка, головой становится следующий узел.
+  // Единственный узел одновременно и голова, и хвост: после него список пуст.
   if (current == head_) {
-    // Если следующий узел существует (не является size_node_), обновляем голову списка.
-    if (current->next_ != size_node_ && current->next_) {
-      head_ = current->next_;
-    } else {
-      // Если следующий узел не существует, то голова списка становится псевдо-узел size_node_.
-      head_ = size_node_;
-    }
-  } 
-  // Если удаляемый узел - это хвост списка.
-  else if (current == tail_) {
-    // Если предыдущий узел существует (не является size_node_), обновляем хвост списка.
-    if (current->prev_ != size_node_ && current->prev_) {
-      tail_ = current->prev_;
-    } else {
-      // Если предыдущий узел не существует, хвост становится псевдо-узел size_node_.
-      tail_ = size_node_;
-    }
+    head_ = size_ > 1 ? current->next_ : nullptr;
+  }
+  // Если удаляемый узел - это хвост списка, хвостом становится предыдущий узел.
+  if (current == tail_) {
+    tail_ = size_ > 1 ? current->prev_ : nullptr;
   }
 
   // Обновляем ссылки на следующий и предыдущий узлы для окружающих элементов.
@@ -413,7 +464,7 @@ void list<T>::erase(list<T>::iterator pos) {
   current->next_->prev_ = current->prev_; // Следующий узел теперь ссылается на предыдущий.
 
   // Удаляем текущий узел.
-  delete current;
+  destroy_node(current);
 
   // Уменьшаем размер списка на 1.
   size_--;
@@ -441,6 +492,9 @@ void list<T>::push_back(list<T>::const_reference value) {
 
   // Увеличиваем размер списка.
   size_++;
+
+  // Связываем новый хвост со служебным узлом, чтобы работали end() и rend().
+  set_size_node();
 };
 
 template <typename T>
@@ -466,42 +520,15 @@ void list<T>::pop_back() {
   }
 
   // Освобождаем память, занятую последним узлом.
-  delete last_node;
+  destroy_node(last_node);
 
   // Уменьшаем размер списка.
   size_--;
-}
 
-template <typename T>
-void list<T>::pop_back() {
-  // Проверка, является ли список пустым.
-  if (empty()) {
-    // Если список пуст, выбрасываем исключение, так как удаление элемента невозможно.
-    throw length_error("list is empty");
-  }
-
-  // Сохраняем указатель на последний узел (хвост списка).
-  node* last_node = tail_;
-
-  // Проверяем, если в списке только один элемент.
-  if (size_ == 1) {
-    // Если в списке только один элемент, то после удаления списка голова и хвост должны стать nullptr.
-    head_ = nullptr;
-    tail_ = nullptr;
-  } else {
-    // Если в списке более одного элемента, обновляем хвост на предыдущий элемент.
-    tail_ = last_node->prev_;
-    tail_->next_ = nullptr;  // Устанавливаем указатель next_ у нового хвоста в nullptr, так как это последний элемент.
-  }
-
-  // Освобождаем память, занятую последним узлом.
-  delete last_node;
-
-  // Уменьшаем размер списка.
-  size_--;
+  // Связываем новый хвост со служебным узлом.
+  set_size_node();
 }
 
-
 template <typename T>
 void list<T>::push_front(list<T>::const_reference value) {
   // Создаем новый узел с переданным значением.
@@ -511,20 +538,23 @@ void list<T>::push_front(list<T>::const_reference value) {
   if (empty()) {
     head_ = new_head;  // Новый элемент становится головой.
     tail_ = new_head;  // Новый элемент также становится хвостом.
+  } else {
+    // Если список не пуст, то вставляем новый элемент в начало списка.
+    new_head->next_ = head_;  // Новый элемент указывает на текущую голову.
+    head_->prev_ = new_head;  // Старая голова теперь ссылается на новый элемент.
+    head_ = new_head;         // Новый элемент становится новой головой списка.
   }
 
-  // Если список не пуст, то вставляем новый элемент в начало списка.
-  new_head->next_ = head_;  // Новый элемент указывает на текущую голову.
-  head_->prev_ = new_head;  // Старая голова теперь ссылается на новый элемент.
-  head_ = new_head;         // Новый элемент становится новой головой списка.
-
   // Увеличиваем размер списка.
   size_++;
+
+  // Связываем новую голову со служебным узлом.
+  set_size_node();
 }
 
 
 template <typename T>
-void list<T>::swap(list<T>& other) {
+void list<T>::swap(list<T>& other) noexcept {
   // Обмениваем указатели на голову списков.
   std::swap(head_, other.head_);
   
@@ -536,6 +566,11 @@ void list<T>::swap(list<T>& other) {
   
   // Обмениваем указатели на size_node_ (если есть).
   std::swap(size_node_, other.size_node_);
+
+  // Обмениваем непрерывные блоки узлов вместе с их учётом.
+  std::swap(arena_, other.arena_);
+  std::swap(arena_capacity_, other.arena_capacity_);
+  std::swap(arena_live_, other.arena_live_);
 }
 
 
@@ -560,8 +595,12 @@ void list<T>::merge(list<T>& other) {
           other_iterator++;
         } else {
           // Если элемент из списка this меньше элемента из списка other, переходим к следующему элементу в списке this.
+          prefetch_ahead(this_iterator.ptr_);
           this_iterator++;
         }
+      } else {
+        // Элементы второго списка закончились раньше: остаток первого уже на месте.
+        break;
       }
     }
     
@@ -596,21 +635,19 @@ template <typename T>
 void list<T>::reverse() {
   // Проверка, что список не пуст
   if (!this->empty()) {
-    // Инициализация указателей
+    // Проход по списку: в каждом узле next_ и prev_ меняются местами,
+    // так что обе цепочки остаются согласованными.
     node* current = head_;  // Указатель на текущий элемент
-    node* prev = NULL;      // Указатель на предыдущий элемент (вначале NULL)
-    node* next = NULL;      // Указатель на следующий элемент (для временного хранения)
-
-    // Проход по списку с разворотом направлений указателей
-    while (current != size_node_) {  // Пока не достигнем конца списка
-      next = current->next_;  // Сохраняем следующий элемент
-      current->next_ = prev;  // Меняем направление: текущий элемент теперь указывает на предыдущий
-      prev = current;         // Перемещаем указатель prev на текущий элемент
+    for (size_type i = 0; i < size_; i++) {
+      prefetch_ahead(current);  // Заранее подгружаем узел через один
+      node* next = current->next_;  // Сохраняем следующий элемент
+      std::swap(current->next_, current->prev_);
       current = next;         // Переходим к следующему элементу
     }
-    
-    // Обновляем head_ на последний обработанный элемент (теперь это новый первый элемент)
-    head_ = prev;
+
+    // Голова и хвост меняются ролями, служебный узел связывается с ними заново
+    std::swap(head_, tail_);
+    set_size_node();
   }
 }
 
@@ -621,6 +658,7 @@ void list<T>::unique() {
   if (!this->empty()) {
     // Итерируем по списку с помощью итератора
     for (iterator iter = this->begin(); iter != this->end(); iter++) {
+      prefetch_ahead(iter.ptr_);  // Заранее подгружаем узел через один
       // Если текущий элемент равен предыдущему, значит, это дубликат
       if (iter.ptr_->value_ == iter.ptr_->prev_->value_) {
         // Удаляем предыдущий элемент, так как текущий и предыдущий одинаковы
@@ -635,41 +673,164 @@ void list<T>::unique() {
 template <typename T>
 typename list<T>::node* list<T>::merge_nodes(list<T>::node* left_part,
                                              list<T>::node* right_part) {
+  // Фиктивное начало результата, к которому подцепляются выбранные узлы
   node* result = nullptr;
-
-  // Если левая часть пустая, то возвращаем правую часть
-  if (left_part == nullptr) {
-    return right_part;
-  } 
-  // Если правая часть пустая, то возвращаем левую часть
-  else if (right_part == nullptr) {
-    return left_part;
-  }
-
-  // Сравниваем значения текущих узлов в обеих частях
-  if (left_part->value_ > right_part->value_) {
-    // Если значение в правой части меньше, то выбираем его
-    result = right_part;
-    // Рекурсивно вызываем merge_nodes для следующего элемента правой части и текущего элемента левой части
-    result->next_ = merge_nodes(left_part, right_part->next_);
-  } else {
-    // Если значение в левой части меньше, то выбираем его
-    result = left_part;
-    // Рекурсивно вызываем merge_nodes для следующего элемента левой части и текущего элемента правой части
-    result->next_ = merge_nodes(left_part->next_, right_part);
+  node** last = &result;
+
+  // Пока в обеих частях есть узлы, переносим меньший из головных
+  while (left_part != nullptr && right_part != nullptr) {
+    // При равенстве берём узел левой части, чтобы слияние было устойчивым
+    if (right_part->value_ < left_part->value_) {
+      *last = right_part;
+      right_part = right_part->next_;
+    } else {
+      *last = left_part;
+      left_part = left_part->next_;
+    }
+    last = &(*last)->next_;
   }
 
+  // Остаток непустой части уже отсортирован, подцепляем его целиком
+  *last = left_part != nullptr ? left_part : right_part;
+
   // Возвращаем результат слияния двух отсортированных частей
   return result;
 }
 
 
+// Восстанавливает двусвязный список из цепочки next_ длиной size_ узлов,
+// начинающейся с first: проставляет prev_, head_, tail_ и связи со служебным узлом.
+template <typename T>
+void list<T>::relink_chain(node* first) {
+  node* prev = size_node_;
+  node* current = first;
+  for (size_type i = 0; i < size_; i++) {
+    current->prev_ = prev;
+    prev = current;
+    current = current->next_;
+  }
+  head_ = first;
+  tail_ = prev;
+  set_size_node();
+}
+
+
+// Поразрядная (LSD radix) сортировка узлов по ключу key_fn(value).
+// Ключи вычисляются один раз и вместе с указателями на узлы складываются в
+// плотный массив: проходы сортировки идут по нему последовательно, без
+// переходов по узлам и без сравнений (а значит, без ошибок предсказания
+// ветвлений). Затем узлы перешиваются за один проход по отсортированному массиву.
+template <typename T>
+template <class KeyFn>
+void list<T>::radix_sort_nodes(KeyFn key_fn) {
+  using key_type = decltype(detail::radix_key(key_fn(head_->value_)));
+  struct keyed {
+    key_type key_;
+    node* ptr_;
+  };
+  // Буферы освобождаются и при исключении из key_fn
+  std::unique_ptr<keyed[]> owned_items(new keyed[size_]);
+  std::unique_ptr<keyed[]> owned_scratch(new keyed[size_]);
+  keyed* items = owned_items.get();
+  keyed* scratch = owned_scratch.get();
+
+  node* current = head_;
+  for (size_type i = 0; i < size_; i++) {
+    items[i].key_ = detail::radix_key(key_fn(current->value_));
+    items[i].ptr_ = current;
+    current = current->next_;
+  }
+  detail::radix_sort(items, scratch, size_,
+                     [](const keyed& item) { return item.key_; });
+
+  for (size_type i = 0; i + 1 < size_; i++) {
+    items[i].ptr_->next_ = items[i + 1].ptr_;
+  }
+  items[size_ - 1].ptr_->next_ = nullptr;
+  relink_chain(items[0].ptr_);
+}
+
+
+// Поразрядная сортировка значений арифметического типа. Числа дешевле
+// переставить, чем перешивать узлы: значения выписываются в плотный массив,
+// сортируются в нём и записываются обратно в узлы в прежнем порядке узлов.
+// Оба прохода по списку последовательные, а узлы остаются на своих местах в
+// памяти, так что последующие обходы не теряют локальность (перешивка по
+// массиву указателей разбросала бы соседние элементы по куче).
+template <typename T>
+void list<T>::radix_sort_values() {
+  // Буферы освобождаются и при исключении из копирования T
+  std::unique_ptr<value_type[]> owned_values(new value_type[size_]);
+  std::unique_ptr<value_type[]> owned_scratch(new value_type[size_]);
+  value_type* values = owned_values.get();
+  value_type* scratch = owned_scratch.get();
+
+  node* current = head_;
+  for (size_type i = 0; i < size_; i++) {
+    values[i] = current->value_;
+    current = current->next_;
+  }
+  detail::radix_sort(values, scratch, size_, [](const value_type& value) {
+    return detail::radix_key(value);
+  });
+  current = head_;
+  for (size_type i = 0; i < size_; i++) {
+    current->value_ = values[i];
+    current = current->next_;
+  }
+}
+
+
+// Устойчивая сортировка по арифметическому ключу, например по полю записи:
+// list.sort_by_key([](const record& r) { return r.timestamp; }).
+template <typename T>
+template <class KeyFn>
+void list<T>::sort_by_key(KeyFn key_fn) {
+  if (size_ > 1) {
+    radix_sort_nodes(key_fn);
+  }
+}
+
+
+// Сортирует список. Для целых, float и double используется поразрядная
+// сортировка значений (radix_sort_values), для остальных — слияние узлов снизу вверх:
+// значения не копируются, переставляются только указатели. В bins[i] хранится
+// уже отсортированная цепочка из 2^i узлов; каждый новый узел "переносится" по
+// разрядам, как при двоичном сложении. Время O(n log n) при любом исходном
+// порядке, глубина рекурсии не растёт, равные элементы сохраняют взаимный порядок.
 template <typename value_type>
 void list<value_type>::sort() {
+  // На коротких списках подготовка буферов дороже самой сортировки
+  if constexpr (detail::has_radix_key<value_type>) {
+    if (size_ > 64) {
+      radix_sort_values();
+      return;
+    }
+  }
   // Проверяем, что в списке больше одного элемента
   if (size_ > 1) {
-    // Вызываем функцию быстрой сортировки, передавая итераторы на начало и конец списка
-    quick_sort(begin(), --end());
+    node* bins[64] = {};
+    node* chain = head_;
+    for (size_type k = 0; k < size_; k++) {
+      node* current = chain;
+      chain = chain->next_;
+      current->next_ = nullptr;
+      int i = 0;
+      for (; bins[i] != nullptr; i++) {
+        current = merge_nodes(bins[i], current);
+        bins[i] = nullptr;
+      }
+      bins[i] = current;
+    }
+
+    // Сливаем оставшиеся цепочки: в старших разрядах лежат более ранние узлы
+    node* result = nullptr;
+    for (int i = 0; i < 64; i++) {
+      if (bins[i] != nullptr) {
+        result = merge_nodes(bins[i], result);
+      }
+    }
+    relink_chain(result);
   }
 }
 
@@ -718,18 +879,160 @@ typename list<value_type>::iterator list<value_type>::partition(iterator first,
   return i;
 }
 
+// Отдаёт все узлы списка вызывающему (см. merge_all): возвращает первый и
+// последний узлы цепочки из size() узлов, связанных через next_ и prev_, а список становится
+// пустым. Узлы из блока arena_ освобождаются только вместе с блоком, поэтому
+// после relayout() они предварительно переносятся в отдельные узлы — по одному
+// выделению памяти на узел блока. Если выделение или копирование бросает
+// исключение, уже перенесённые узлы остаются в списке перед непереложенными,
+// и список сохраняет все свои элементы в прежнем порядке.
+template <typename T>
+std::pair<typename list<T>::node*, typename list<T>::node*>
+list<T>::release_nodes() {
+  if (arena_) {
+    std::less<node*> less;
+    node* first = nullptr;
+    node* prev = nullptr;
+    node* current = head_;
+    try {
+      for (size_type i = 0; i < size_; i++) {
+        node* next = current->next_;
+        node* kept = current;
+        if (!less(current, arena_) && less(current, arena_ + arena_capacity_)) {
+          kept = new node(std::move_if_noexcept(current->value_));
+          destroy_node(current);
+        }
+        kept->prev_ = prev;
+        if (prev) {
+          prev->next_ = kept;
+        } else {
+          first = kept;
+        }
+        prev = kept;
+        current = next;
+      }
+    } catch (...) {
+      // Сцепляем перенесённую часть с оставшейся, начиная с current.
+      if (prev) {
+        prev->next_ = current;
+        current->prev_ = prev;
+        head_ = first;
+      }
+      set_size_node();
+      throw;
+    }
+    head_ = first;
+    tail_ = prev;
+  }
+
+  std::pair<node*, node*> chain(head_, tail_);
+  head_ = tail_ = nullptr;
+  size_ = 0;
+  set_size_node();
+  return chain;
+}
+
+// Принимает цепочку из count узлов от first до last, уже связанных через next_
+// и prev_ (например, полученных через release_nodes()), вместо текущего
+// содержимого списка. Прежние элементы списка удаляются.
+template <typename T>
+void list<T>::adopt_nodes(node* first, node* last, size_type count) {
+  clear();
+  head_ = count ? first : nullptr;
+  tail_ = count ? last : nullptr;
+  size_ = count;
+  set_size_node();
+}
+
+// Переносит все узлы списка в один непрерывный блок памяти в порядке обхода.
+// После долгой череды insert/erase узлы разбросаны по куче, и обход списка
+// упирается в промахи кэша; после relayout() соседние элементы лежат рядом.
+// Значения перемещаются в новые узлы, поэтому все итераторы и указатели на
+// узлы списка становятся недействительными.
+// Если перемещение T может бросить исключение, значения копируются
+// (std::move_if_noexcept); при исключении блок уничтожается, а список
+// остаётся прежним.
+template <typename T>
+void list<T>::relayout() {
+  if (size_ == 0) {
+    return;
+  }
+
+  // Выделяем сырой блок под size_ узлов.
+  node* block = static_cast<node*>(::operator new(size_ * sizeof(node)));
+
+  // Переносим значения в блок по порядку; старые узлы пока не трогаем.
+  size_type built = 0;
+  try {
+    for (node* current = head_; built < size_; built++, current = current->next_) {
+      new (block + built) node(std::move_if_noexcept(current->value_));
+    }
+  } catch (...) {
+    for (size_type i = 0; i < built; i++) block[i].~node();
+    ::operator delete(block);
+    throw;
+  }
+
+  // Все значения на месте: освобождаем старые узлы.
+  node* current = head_;
+  for (size_type i = 0; i < size_; i++) {
+    node* next = current->next_;
+    destroy_node(current);
+    current = next;
+  }
+
+  // Связываем узлы блока между собой и со служебным узлом.
+  for (size_type i = 0; i < size_; i++) {
+    block[i].prev_ = i ? block + i - 1 : size_node_;
+    block[i].next_ = i + 1 < size_ ? block + i + 1 : size_node_;
+  }
+  head_ = block;
+  tail_ = block + size_ - 1;
+  set_size_node();
+
+  // Старый блок уже освобождён в destroy_node, запоминаем новый.
+  arena_ = block;
+  arena_capacity_ = size_;
+  arena_live_ = size_;
+}
+
+// Удаляет узел списка. Узлы, созданные relayout(), лежат в общем блоке arena_:
+// для них вызывается только деструктор, а сам блок освобождается вместе с
+// последним живым узлом. Остальные узлы выделены через new и удаляются delete.
+template <typename T>
+void list<T>::destroy_node(node* ptr) {
+  std::less<node*> less;
+  if (arena_ && !less(ptr, arena_) && less(ptr, arena_ + arena_capacity_)) {
+    ptr->~node();
+    if (--arena_live_ == 0) {
+      ::operator delete(arena_);
+      arena_ = nullptr;
+      arena_capacity_ = 0;
+    }
+  } else {
+    delete ptr;
+  }
+}
+
 // Конструктор по умолчанию для итератора
 template <typename T>
-list<T>::listIterator::listIterator() {}
+list<T>::listIterator::listIterator() noexcept {}
 
 // Конструктор итератора, принимающий указатель на узел списка
 template <typename T>
-list<T>::listIterator::listIterator(typename list<T>::node* ptr) : ptr_(ptr) {}
+list<T>::listIterator::listIterator(typename list<T>::node* ptr) noexcept
+    : ptr_(ptr) {}
 
 // Операция пре-инкремента (++iter) для итератора.
 // Сдвигает указатель итератора на следующий элемент списка.
+// В режиме S21_CHECK_ASSERT проверяется, что итератор не стоит на end().
 template <typename T>
-typename list<T>::listIterator& list<T>::listIterator::operator++() {
+typename list<T>::listIterator& list<T>::listIterator::operator++()
+    S21_CHECKED_NOEXCEPT {
+#if S21_BOUNDS_CHECK == S21_CHECK_ASSERT
+  assert(ptr_ != end_ && "increment of end() iterator");
+#endif
+  prefetch_ahead(ptr_);  // Подсказка для узла, до которого дойдём через шаг
   ptr_ = ptr_->next_;  // Переход к следующему элементу
   return *this;        // Возвращаем текущий итератор для цепочки операций
 }
@@ -737,7 +1040,8 @@ typename list<T>::listIterator& list<T>::listIterator::operator++() {
 // Операция пост-инкремента (iter++) для итератора.
 // Создает копию текущего итератора, сдвигает указатель на следующий элемент и возвращает копию.
 template <typename T>
-typename list<T>::listIterator list<T>::listIterator::operator++(int) {
+typename list<T>::listIterator list<T>::listIterator::operator++(int)
+    S21_CHECKED_NOEXCEPT {
   listIterator temp = *this;  // Создаем копию текущего итератора
   ++(*this);                  // Инкрементируем текущий итератор
   return temp;                 // Возвращаем прежний итератор (копию)
@@ -746,7 +1050,7 @@ typename list<T>::listIterator list<T>::listIterator::operator++(int) {
 // Операция пре-декремента (--iter) для итератора.
 // Сдвигает указатель итератора на предыдущий элемент списка.
 template <typename T>
-typename list<T>::listIterator& list<T>::listIterator::operator--() {
+typename list<T>::listIterator& list<T>::listIterator::operator--() noexcept {
   ptr_ = ptr_->prev_;  // Переход к предыдущему элементу
   return *this;        // Возвращаем текущий итератор для цепочки операций
 }
@@ -754,7 +1058,7 @@ typename list<T>::listIterator& list<T>::listIterator::operator--() {
 // Операция пост-декремента (iter--) для итератора.
 // Создает копию текущего итератора, сдвигает указатель на предыдущий элемент и возвращает копию.
 template <typename T>
-typename list<T>::listIterator list<T>::listIterator::operator--(int) {
+typename list<T>::listIterator list<T>::listIterator::operator--(int) noexcept {
   listIterator temp = *this;  // Создаем копию текущего итератора
   --(*this);                  // Декрементируем текущий итератор
   return temp;                 // Возвращаем прежний итератор (копию)
@@ -762,7 +1066,7 @@ typename list<T>::listIterator list<T>::listIterator::operator--(int) {
 
 template <typename T>
 typename list<T>::listIterator list<T>::listIterator::operator-(
-    list<T>::size_type value) {
+    list<T>::size_type value) noexcept {
   
   // Временная переменная temp, которая будет использоваться для навигации по списку
   node* temp = ptr_;
@@ -774,7 +1078,8 @@ typename list<T>::listIterator list<T>::listIterator::operator-(
   }
   
   // Создание нового итератора result, который будет указывать на узел 'temp'
-  listIterator result(temp);
+  listIterator result(*this);
+  result.ptr_ = temp;
   
   // Возврат нового итератора, который теперь указывает на позицию, сдвинутую на 'value' шагов назад
   return result;
@@ -782,6 +1087,9 @@ typename list<T>::listIterator list<T>::listIterator::operator-(
 // Оператор разыменовывания для итератора
 template <typename T>
 typename list<T>::value_type list<T>::listIterator::operator*() const {
+#if S21_BOUNDS_CHECK == S21_CHECK_ASSERT
+  assert(ptr_ != end_ && "dereference of end() iterator");
+#endif
   // Возвращаем значение, на которое указывает итератор, из поля value_ текущего узла
   return ptr_->value_;
 }
@@ -795,18 +1103,164 @@ typename list<T>::value_type list<T>::listIterator::operator->() const {
 
 // Оператор равенства для итераторов
 template <typename T>
-bool list<T>::listIterator::operator==(list<T>::listIterator other) {
+bool list<T>::listIterator::operator==(list<T>::listIterator other) noexcept {
   // Сравниваем указатели на узлы, на которые указывают два итератора
   return (this->ptr_ == other.ptr_);
 }
 
 // Оператор неравенства для итераторов
 template <typename T>
-bool list<T>::listIterator::operator!=(list<T>::listIterator other) {
+bool list<T>::listIterator::operator!=(list<T>::listIterator other) noexcept {
   // Сравниваем указатели на узлы, на которые указывают два итератора
   return (this->ptr_ != other.ptr_);
 }
 
+// Конструктор по умолчанию для обратного итератора
+template <typename T>
+list<T>::listReverseIterator::listReverseIterator() noexcept {}
+
+// Конструктор обратного итератора, принимающий указатель на узел списка
+template <typename T>
+list<T>::listReverseIterator::listReverseIterator(node* ptr) noexcept
+    : ptr_(ptr) {}
+
+// Пре-инкремент обратного итератора: переход к предыдущему узлу списка
+template <typename T>
+typename list<T>::listReverseIterator&
+list<T>::listReverseIterator::operator++() noexcept {
+  ptr_ = ptr_->prev_;
+  return *this;
+}
+
+// Пост-инкремент обратного итератора
+template <typename T>
+typename list<T>::listReverseIterator
+list<T>::listReverseIterator::operator++(int) noexcept {
+  listReverseIterator temp = *this;
+  ++(*this);
+  return temp;
+}
+
+// Пре-декремент обратного итератора: переход к следующему узлу списка
+template <typename T>
+typename list<T>::listReverseIterator&
+list<T>::listReverseIterator::operator--() noexcept {
+  ptr_ = ptr_->next_;
+  return *this;
+}
+
+// Пост-декремент обратного итератора
+template <typename T>
+typename list<T>::listReverseIterator
+list<T>::listReverseIterator::operator--(int) noexcept {
+  listReverseIterator temp = *this;
+  --(*this);
+  return temp;
+}
+
+// Разыменование обратного итератора: ссылка на значение текущего узла
+template <typename T>
+typename list<T>::listReverseIterator::reference
+list<T>::listReverseIterator::operator*() const noexcept {
+  return ptr_->value_;
+}
+
+// Доступ к члену значения текущего узла
+template <typename T>
+typename list<T>::listReverseIterator::pointer
+list<T>::listReverseIterator::operator->() const noexcept {
+  return &ptr_->value_;
+}
+
+// Обратные итераторы равны, если указывают на один и тот же узел
+template <typename T>
+bool list<T>::listReverseIterator::operator==(
+    const listReverseIterator& other) const noexcept {
+  return ptr_ == other.ptr_;
+}
+
+template <typename T>
+bool list<T>::listReverseIterator::operator!=(
+    const listReverseIterator& other) const noexcept {
+  return ptr_ != other.ptr_;
+}
+
+// Конструктор по умолчанию для константного обратного итератора
+template <typename T>
+list<T>::listConstReverseIterator::listConstReverseIterator() noexcept {}
+
+// Конструктор константного обратного итератора, принимающий указатель на узел
+template <typename T>
+list<T>::listConstReverseIterator::listConstReverseIterator(const node* ptr) noexcept
+    : ptr_(ptr) {}
+
+// Преобразование изменяемого обратного итератора в константный
+template <typename T>
+list<T>::listConstReverseIterator::listConstReverseIterator(
+    listReverseIterator other) noexcept
+    : ptr_(other.ptr_) {}
+
+// Пре-инкремент: переход к предыдущему узлу списка
+template <typename T>
+typename list<T>::listConstReverseIterator&
+list<T>::listConstReverseIterator::operator++() noexcept {
+  ptr_ = ptr_->prev_;
+  return *this;
+}
+
+// Пост-инкремент константного обратного итератора
+template <typename T>
+typename list<T>::listConstReverseIterator
+list<T>::listConstReverseIterator::operator++(int) noexcept {
+  listConstReverseIterator temp = *this;
+  ++(*this);
+  return temp;
+}
+
+// Пре-декремент: переход к следующему узлу списка
+template <typename T>
+typename list<T>::listConstReverseIterator&
+list<T>::listConstReverseIterator::operator--() noexcept {
+  ptr_ = ptr_->next_;
+  return *this;
+}
+
+// Пост-декремент константного обратного итератора
+template <typename T>
+typename list<T>::listConstReverseIterator
+list<T>::listConstReverseIterator::operator--(int) noexcept {
+  listConstReverseIterator temp = *this;
+  --(*this);
+  return temp;
+}
+
+// Разыменование: константная ссылка на значение текущего узла
+template <typename T>
+typename list<T>::listConstReverseIterator::reference
+list<T>::listConstReverseIterator::operator*() const noexcept {
+  return ptr_->value_;
+}
+
+// Доступ к члену значения текущего узла только для чтения
+template <typename T>
+typename list<T>::listConstReverseIterator::pointer
+list<T>::listConstReverseIterator::operator->() const noexcept {
+  return &ptr_->value_;
+}
+
+// Константные обратные итераторы равны, если указывают на один и тот же узел
+template <typename T>
+bool list<T>::listConstReverseIterator::operator==(
+    const listConstReverseIterator& other) const noexcept {
+  return ptr_ == other.ptr_;
+}
+
+template <typename T>
+bool list<T>::listConstReverseIterator::operator!=(
+    const listConstReverseIterator& other) const noexcept {
+  return ptr_ != other.ptr_;
+}
+
 // Конструктор для создания константного итератора из обычного итератора
 template <typename T>
 list<T>::listConstIterator::listConstIterator(listIterator other)
@@ -819,4 +1273,5 @@ typename list<T>::const_reference list<T>::listConstIterator::operator*() {
   return listIterator::operator*();
 }
 
-};  // namespace s21
\ No newline at end of file
+}  // inline namespace S21_BOUNDS_ABI
+}  // namespace s21
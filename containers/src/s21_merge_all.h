@@ -0,0 +1,66 @@
+#ifndef S21_MERGE_ALL_H
+#define S21_MERGE_ALL_H
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+
+#include "s21_list.h"
+
+namespace s21 {
+namespace detail {
+
+// Тип списка-результата для контейнера списков Lists
+template <class Lists>
+using merged_list_t =
+    std::decay_t<decltype(*std::begin(std::declval<Lists&>()))>;
+
+// Единственная точка доступа к закрытым release_nodes()/adopt_nodes() списка
+struct list_access {
+  template <class List>
+  static auto release_nodes(List& source) {
+    return source.release_nodes();
+  }
+  template <class List, class Node>
+  static void adopt_nodes(List& target, Node* first, Node* last,
+                          std::size_t count) {
+    target.adopt_nodes(first, last, count);
+  }
+};
+
+}  // namespace detail
+
+// k-путевое слияние отсортированных списков в один.
+//
+// lists — контейнер s21::list<T> (std::vector, s21::array и т. п.), каждый
+// список упорядочен по comp. Узлы не копируются и не выделяются заново: они
+// перецепляются из исходных списков в результат, очередной узел выбирается
+// двоичной кучей по головам списков, поэтому слияние n элементов занимает
+// O(n log k), а дополнительная память — только куча из k индексов. Слияние
+// устойчивое: при равных элементах первым идёт элемент из списка, который
+// стоит в lists раньше. Все исходные списки остаются пустыми, как после merge.
+//
+// При threads > 1 диапазон ключей делится разделителями, взятыми из самого
+// длинного списка, на threads частей; каждая часть сливается в своём потоке,
+// и готовые части сцепляются за O(threads). Порядок результата тот же, что
+// и при последовательном слиянии.
+//
+// Если comp бросает исключение, ни один узел не теряется: все элементы
+// собираются в первом списке lists в неопределённом порядке, остальные списки
+// остаются пустыми, и исключение передаётся дальше.
+//
+// Узлы списка после relayout() лежат в общем блоке, который нельзя отдать по
+// частям, поэтому такие списки сначала переносятся в отдельные узлы (см.
+// list::release_nodes): по одному выделению памяти и перемещению T на элемент.
+// Чтобы слияние обошлось без выделений, вызывайте relayout() для результата,
+// а не для исходных списков.
+template <class Lists, class Compare = std::less<>>
+detail::merged_list_t<Lists> merge_all(Lists& lists, Compare comp = Compare(),
+                                       std::size_t threads = 1);
+
+}  // namespace s21
+
+#include "s21_merge_all.tpp"
+
+#endif  // S21_MERGE_ALL_H
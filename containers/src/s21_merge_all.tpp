@@ -0,0 +1,245 @@
+#include <algorithm>
+#include <cstddef>
+#include <future>
+#include <initializer_list>
+#include <utility>
+#include <vector>
+
+#include "s21_merge_all.h"
+
+namespace s21 {
+namespace detail {
+
+// Цепочка узлов списка, связанных через next_ и prev_. Число узлов хранится
+// явно, поэтому next_ последнего узла может указывать куда угодно.
+template <class Node>
+struct node_chain {
+  Node* first_ = nullptr;
+  Node* last_ = nullptr;
+  std::size_t size_ = 0;
+
+  // Дописывает узел в конец цепочки
+  void push_back(Node* ptr) {
+    ptr->prev_ = last_;
+    if (last_) {
+      last_->next_ = ptr;
+    } else {
+      first_ = ptr;
+    }
+    last_ = ptr;
+    size_++;
+  }
+
+  // Переносит в конец цепочки все узлы other за O(1)
+  void append(node_chain& other) {
+    if (other.size_ == 0) return;
+    other.first_->prev_ = last_;
+    if (last_) {
+      last_->next_ = other.first_;
+    } else {
+      first_ = other.first_;
+    }
+    last_ = other.last_;
+    size_ += other.size_;
+    other = node_chain();
+  }
+};
+
+// Элемент кучи: головной узел цепочки и номер цепочки (для устойчивости)
+template <class Node>
+struct merge_head {
+  Node* node_;
+  std::size_t index_;
+};
+
+// Просеивание вершины кучи вниз. Вершина — элемент, который выходит раньше
+// всех; later(a, b) — элемент a должен выйти после b.
+template <class Head, class Later>
+void sift_down(std::vector<Head>& heap, Later& later) {
+  const std::size_t n = heap.size();
+  const Head item = heap[0];
+  std::size_t i = 0;
+  for (std::size_t child = 1; child < n; child = 2 * i + 1) {
+    if (child + 1 < n && later(heap[child], heap[child + 1])) child++;
+    if (!later(item, heap[child])) break;
+    heap[i] = heap[child];
+    i = child;
+  }
+  heap[i] = item;
+}
+
+// Сливает count цепочек в result на двоичной куче. Куча хранит сами головные
+// узлы, так что сравнение не ходит через массив цепочек. Вместо pop и push
+// на каждом шаге вершина заменяется следующим узлом той же цепочки и
+// просеивается вниз; когда остаётся одна цепочка, она дописывается целиком.
+// Узел снимается с цепочки до сравнений, поэтому если comp бросает исключение,
+// каждый узел лежит либо в result, либо в одной из цепочек.
+template <class Node, class Compare>
+void merge_chains(node_chain<Node>* chains, std::size_t count, Compare& comp,
+                  node_chain<Node>& result) {
+  using head = merge_head<Node>;
+  auto later = [&comp](const head& a, const head& b) {
+    return comp(b.node_->value_, a.node_->value_) ||
+           (!comp(a.node_->value_, b.node_->value_) && b.index_ < a.index_);
+  };
+  std::vector<head> heap;
+  heap.reserve(count);
+  for (std::size_t i = 0; i < count; i++) {
+    if (chains[i].size_) heap.push_back(head{chains[i].first_, i});
+  }
+  std::make_heap(heap.begin(), heap.end(), later);
+
+  while (heap.size() > 1) {
+    head& top = heap.front();
+    node_chain<Node>& source = chains[top.index_];
+    Node* ptr = top.node_;
+    source.first_ = ptr->next_;
+    source.size_--;
+    result.push_back(ptr);
+    if (source.size_) {
+      top.node_ = source.first_;
+#ifdef S21_LIST_PREFETCH
+      // Следующий узел этой цепочки понадобится, когда она снова окажется наверху
+      __builtin_prefetch(source.first_->next_);
+#endif
+      sift_down(heap, later);
+    } else {
+      std::pop_heap(heap.begin(), heap.end(), later);
+      heap.pop_back();
+    }
+  }
+  if (!heap.empty()) result.append(chains[heap.front().index_]);
+}
+
+// Раскладывает цепочку source по частям диапазона ключей: в часть p попадают
+// элементы, не меньшие pivots[p - 1] и меньшие pivots[p]. Часть p цепочки с
+// номером index записывается в segments[p * stride + index]. Узел покидает
+// source только после сравнений, так что исключение из comp не теряет узлов.
+template <class Node, class Value, class Compare>
+void cut_chain(node_chain<Node>& source, const std::vector<Value>& pivots,
+               Compare& comp, node_chain<Node>* segments, std::size_t index,
+               std::size_t stride) {
+  std::size_t part = 0;
+  while (source.size_) {
+    Node* ptr = source.first_;
+    while (part < pivots.size() && !comp(ptr->value_, pivots[part])) part++;
+    source.first_ = ptr->next_;
+    source.size_--;
+    segments[part * stride + index].push_back(ptr);
+  }
+  source = node_chain<Node>();
+}
+
+}  // namespace detail
+
+template <class Lists, class Compare>
+detail::merged_list_t<Lists> merge_all(Lists& lists, Compare comp,
+                                       std::size_t threads) {
+  using list_type = detail::merged_list_t<Lists>;
+  using value_type = typename list_type::value_type;
+  using node = std::remove_pointer_t<
+      decltype(detail::list_access::release_nodes(std::declval<list_type&>()).first)>;
+  using chain = detail::node_chain<node>;
+
+  // Результат создаётся заранее: после снятия узлов выделять память нельзя
+  list_type result;
+
+  // Снимаем узлы со всех исходных списков. Если release_nodes() бросает
+  // исключение, уже снятые узлы возвращаются в свои списки.
+  std::vector<chain> chains;
+  chains.reserve(static_cast<std::size_t>(
+      std::distance(std::begin(lists), std::end(lists))));
+  std::size_t longest = 0;
+  try {
+    for (list_type& source : lists) {
+      chain c;
+      c.size_ = source.size();
+      std::pair<node*, node*> ends = detail::list_access::release_nodes(source);
+      c.first_ = ends.first;
+      c.last_ = ends.second;
+      if (chains.empty() || c.size_ > chains[longest].size_) longest = chains.size();
+      chains.push_back(c);
+    }
+  } catch (...) {
+    std::size_t i = 0;
+    for (list_type& source : lists) {
+      if (i == chains.size()) break;
+      chain& c = chains[i++];
+      if (c.size_) detail::list_access::adopt_nodes(source, c.first_, c.last_, c.size_);
+    }
+    throw;
+  }
+  const std::size_t k = chains.size();
+
+  // Слитые узлы, части по разделителям и слитые части. Если comp бросает
+  // исключение, каждый узел лежит ровно в одной из этих цепочек.
+  chain merged;
+  std::vector<chain> segments;
+  std::vector<chain> parts_merged;
+  try {
+    const std::size_t parts =
+        k == 0 || threads < 2 ? 1
+                              : std::min(threads, chains[longest].size_);
+    if (parts < 2) {
+      detail::merge_chains(chains.data(), k, comp, merged);
+    } else {
+      // Разделители — равноотстоящие элементы самого длинного списка
+      std::vector<value_type> pivots;
+      pivots.reserve(parts - 1);
+      node* ptr = chains[longest].first_;
+      for (std::size_t i = 0; pivots.size() < parts - 1; i++, ptr = ptr->next_) {
+        if (i == (pivots.size() + 1) * chains[longest].size_ / parts) {
+          pivots.push_back(ptr->value_);
+        }
+      }
+      segments.resize(parts * k);
+      parts_merged.resize(parts);
+
+      // Нарезаем списки по частям: каждый поток берёт свою долю списков.
+      // Деструкторы будущих результатов std::async дожидаются потоков, так что
+      // при исключении обработчик ниже видит цепочки уже без гонок.
+      {
+        std::vector<std::future<void>> tasks;
+        for (std::size_t t = 0; t < parts; t++) {
+          tasks.push_back(std::async(std::launch::async, [&, t] {
+            Compare part_comp(comp);
+            for (std::size_t j = t; j < k; j += parts) {
+              detail::cut_chain(chains[j], pivots, part_comp, segments.data(), j, k);
+            }
+          }));
+        }
+        for (std::future<void>& task : tasks) task.get();
+      }
+
+      // Сливаем части параллельно и сцепляем их по порядку
+      {
+        std::vector<std::future<void>> tasks;
+        for (std::size_t p = 0; p < parts; p++) {
+          tasks.push_back(std::async(std::launch::async, [&, p] {
+            Compare part_comp(comp);
+            detail::merge_chains(segments.data() + p * k, k, part_comp,
+                                 parts_merged[p]);
+          }));
+        }
+        for (std::future<void>& task : tasks) task.get();
+      }
+      for (chain& part : parts_merged) merged.append(part);
+    }
+  } catch (...) {
+    // Все узлы собираются в первом списке lists в неопределённом порядке;
+    // append не выделяет памяти, так что здесь ничего не может бросить.
+    for (std::vector<chain>* group : {&chains, &segments, &parts_merged}) {
+      for (chain& c : *group) merged.append(c);
+    }
+    if (merged.size_) {
+      detail::list_access::adopt_nodes(*std::begin(lists), merged.first_,
+                                       merged.last_, merged.size_);
+    }
+    throw;
+  }
+
+  detail::list_access::adopt_nodes(result, merged.first_, merged.last_, merged.size_);
+  return result;
+}
+
+}  // namespace s21
@@ -0,0 +1,106 @@
+#ifndef S21_RADIX_SORT_H
+#define S21_RADIX_SORT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+namespace detail {
+
+// Беззнаковый тип того же размера, что и ключ
+template <class Key>
+using radix_key_t = std::conditional_t<
+    sizeof(Key) == 1, std::uint8_t,
+    std::conditional_t<sizeof(Key) == 2, std::uint16_t,
+                       std::conditional_t<sizeof(Key) == 4, std::uint32_t,
+                                          std::uint64_t>>>;
+
+// Типы ключей, для которых есть radix_key: целые, float и double. long double
+// сюда не входит — у него больше 64 бит и неиспользуемые байты заполнения.
+template <class Key>
+constexpr bool has_radix_key = std::is_integral<Key>::value ||
+                               std::is_same<Key, float>::value ||
+                               std::is_same<Key, double>::value;
+
+// Преобразует арифметический ключ в беззнаковое число с тем же порядком:
+// у знаковых целых инвертируется знаковый бит, у чисел с плавающей точкой
+// отрицательные значения инвертируются целиком, а у положительных
+// выставляется знаковый бит. NaN оказываются по краям в порядке своих битов.
+template <class Key>
+radix_key_t<Key> radix_key(Key key) {
+  static_assert(has_radix_key<Key>,
+                "radix sort needs an integral, float or double key");
+  using U = radix_key_t<Key>;
+  constexpr U sign = U(U(1) << (sizeof(U) * 8 - 1));
+  if constexpr (std::is_same<Key, bool>::value) {
+    return U(key);
+  } else if constexpr (std::is_floating_point<Key>::value) {
+    U bits;
+    std::memcpy(&bits, &key, sizeof(bits));
+    return (bits & sign) ? U(~bits) : U(bits | sign);
+  } else if constexpr (std::is_signed<Key>::value) {
+    return U(U(key) ^ sign);
+  } else {
+    return U(key);
+  }
+}
+
+// Устойчивая LSD-сортировка по разрядам ключа (младший разряд первым).
+// items и scratch — буферы по n элементов; результат оказывается в items.
+// key_of(item) возвращает беззнаковый ключ (см. radix_key). Ключи до 16 бит
+// сортируются по байтам, более длинные — по 11 бит (64-битный ключ за 6
+// проходов вместо 8; 2048 счётчиков ещё помещаются в L1). Гистограммы всех
+// разрядов считаются за один проход, а разряды, в которых у всех элементов
+// одно и то же значение, пропускаются.
+template <class Item, class KeyOf>
+void radix_sort(Item* items, Item* scratch, std::size_t n, KeyOf key_of) {
+  using U = std::decay_t<decltype(key_of(*items))>;
+  constexpr std::size_t key_bits = sizeof(U) * 8;
+  constexpr std::size_t bits = key_bits > 16 ? 11 : 8;
+  constexpr std::size_t digits = (key_bits + bits - 1) / bits;
+  constexpr std::size_t buckets = std::size_t(1) << bits;
+  constexpr U mask = U(buckets - 1);
+  if (n < 2) return;
+
+  std::unique_ptr<std::size_t[][buckets]> counts(new std::size_t[digits][buckets]());
+  for (std::size_t i = 0; i < n; i++) {
+    U key = key_of(items[i]);
+    for (std::size_t d = 0; d < digits; d++) {
+      counts[d][(key >> (d * bits)) & mask]++;
+    }
+  }
+
+  Item* from = items;
+  Item* to = scratch;
+  for (std::size_t d = 0; d < digits; d++) {
+    std::size_t* count = counts[d];
+    const std::size_t shift = d * bits;
+    // Все элементы в одной корзине: разряд ничего не меняет
+    if (count[(key_of(from[0]) >> shift) & mask] == n) continue;
+
+    std::size_t offset = 0;
+    for (std::size_t b = 0; b < buckets; b++) {
+      std::size_t c = count[b];
+      count[b] = offset;
+      offset += c;
+    }
+    for (std::size_t i = 0; i < n; i++) {
+      to[count[(key_of(from[i]) >> shift) & mask]++] = std::move(from[i]);
+    }
+    std::swap(from, to);
+  }
+
+  // После нечётного числа проходов результат лежит в scratch
+  if (from != items) {
+    for (std::size_t i = 0; i < n; i++) items[i] = std::move(from[i]);
+  }
+}
+
+}  // namespace detail
+}  // namespace s21
+
+#endif  // S21_RADIX_SORT_H
@@ -0,0 +1,167 @@
+#ifndef S21_RCU_LIST_H
+#define S21_RCU_LIST_H
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <mutex>
+#include <stdexcept>
+
+namespace s21 {
+// Список для сценария "много читателей, редкие записи" в стиле RCU.
+// Узлы устроены как в s21::list, но указатель next_ атомарный: читатели
+// обходят список без блокировок и без атомарных read-modify-write операций,
+// а писатели публикуют изменения release-записью next_/head_. Удалённые
+// узлы освобождаются только после "периода ожидания" (epoch-based
+// reclamation), когда ни один читатель уже не может их видеть.
+template <class T>
+class rcu_list {
+ public:
+  // Типы, используемые в классе (тип элемента, ссылка на элемент, константная ссылка, размер)
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = std::size_t;
+
+  // Максимальное количество одновременно зарегистрированных читателей
+  static constexpr size_type max_readers = 64;
+
+ private:
+  // Узел списка: next_ читают читатели, prev_ нужен только писателю
+  struct node {
+    value_type value_;             // Значение, которое хранится в узле
+    std::atomic<node*> next_;      // Указатель на следующий узел
+    node* prev_;                   // Указатель на предыдущий узел (только для писателя)
+    node* retired_next_;           // Связь в цепочке узлов, ожидающих освобождения
+    node(const value_type& value)
+        : value_(value), next_(nullptr), prev_(nullptr), retired_next_(nullptr) {}
+  };
+
+  // Слот читателя занимает отдельную кэш-линию, чтобы читатели не мешали друг другу
+  struct alignas(64) reader_slot {
+    std::atomic<unsigned long> epoch_{0};  // Эпоха входа в чтение, 0 — вне чтения
+    std::atomic<bool> in_use_{false};      // Слот занят объектом reader
+  };
+
+  // Количество удалённых узлов, после которого писатель сам запускает освобождение
+  static constexpr size_type retire_threshold = 64;
+
+  std::atomic<node*> head_{nullptr};  // Указатель на первый элемент списка
+  node* tail_ = nullptr;              // Указатель на последний элемент списка (только для писателя)
+  std::atomic<size_type> size_{0};    // Размер списка (количество элементов)
+
+  std::atomic<unsigned long> epoch_{1};  // Глобальная эпоха
+  reader_slot readers_[max_readers];     // Слоты зарегистрированных читателей
+  node* retired_ = nullptr;              // Узлы, исключённые из списка, но ещё не освобождённые
+  size_type retired_count_ = 0;          // Длина цепочки retired_
+  std::mutex writer_mutex_;              // Сериализует писателей
+
+  // Число секций чтения, открытых текущим потоком. Период ожидания внутри
+  // своей же секции никогда не закончится, поэтому такой поток не освобождает
+  // узлы сам: удалённые узлы копятся до следующей записи вне секции.
+  static inline thread_local size_type read_sections_ = 0;
+
+  void link_before(node* pos, node* first, node* last);  // Публикация цепочки перед pos
+  void retire(node* ptr);  // Откладывает освобождение узла до конца периода ожидания
+  void wait_for_readers(); // Период ожидания: все текущие секции чтения завершены
+  void reclaim();          // Период ожидания и освобождение отложенных узлов
+
+ public:
+  // Константный итератор для обхода списка в прямом направлении
+  class listConstIterator {
+   private:
+    const node* ptr_ = nullptr;  // Указатель на текущий узел
+    friend class rcu_list<T>;
+
+   public:
+    // Характеристики итератора для алгоритмов стандартной библиотеки
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T*;
+    using reference = const T&;
+
+    listConstIterator() {}
+    explicit listConstIterator(const node* ptr) : ptr_(ptr) {}
+    reference operator*() const { return ptr_->value_; }
+    pointer operator->() const { return &ptr_->value_; }
+    listConstIterator& operator++() {
+      ptr_ = ptr_->next_.load(std::memory_order_acquire);
+      return *this;
+    }
+    listConstIterator operator++(int) {
+      listConstIterator temp = *this;
+      ++(*this);
+      return temp;
+    }
+    bool operator==(const listConstIterator& other) const { return ptr_ == other.ptr_; }
+    bool operator!=(const listConstIterator& other) const { return ptr_ != other.ptr_; }
+  };
+
+  using const_iterator = listConstIterator;
+
+  // Дескриптор читателя. Каждый поток-читатель создаёт свой объект reader
+  // один раз (при этом занимается слот) и затем входит в критическую секцию
+  // чтения через lock()/unlock(), read_guard или for_each(). Вход и выход из секции —
+  // это обычные атомарные записи в собственный слот, без блокировок и RMW.
+  // Итераторы действительны только внутри секции; секции не вкладываются.
+  class reader {
+   private:
+    rcu_list* owner_;     // Список, который читает этот читатель
+    reader_slot* slot_;   // Занятый слот
+    bool locked_ = false; // Читатель находится в секции чтения
+
+   public:
+    explicit reader(rcu_list& owner);
+    reader(const reader&) = delete;
+    reader& operator=(const reader&) = delete;
+    ~reader();
+
+    void lock();    // Вход в критическую секцию чтения
+    void unlock();  // Выход из критической секции чтения
+    const_iterator begin() const;  // Итератор на первый элемент (внутри секции)
+    const_iterator end() const;    // Итератор за последним элементом
+    template <class Function>
+    void for_each(Function f);  // Обход всего списка в отдельной секции чтения
+  };
+
+  // Секция чтения на время жизни объекта: lock() в конструкторе и unlock()
+  // в деструкторе, в том числе при выходе по исключению.
+  class read_guard {
+   private:
+    reader& reader_;
+
+   public:
+    explicit read_guard(reader& r) : reader_(r) { reader_.lock(); }
+    read_guard(const read_guard&) = delete;
+    read_guard& operator=(const read_guard&) = delete;
+    ~read_guard() { reader_.unlock(); }
+  };
+
+  rcu_list() {}  // Конструктор по умолчанию
+  rcu_list(std::initializer_list<value_type> const& items);  // Конструктор из списка инициализации
+  rcu_list(const rcu_list&) = delete;
+  rcu_list& operator=(const rcu_list&) = delete;
+  ~rcu_list();  // Деструктор (к этому моменту читателей быть не должно)
+
+  // Функции писателя. Итераторы, передаваемые писателю, берутся из begin()/end()
+  // того же потока-писателя: узлы, которые он видит, может удалить только он сам.
+  const_iterator begin() const;  // Итератор на первый элемент
+  const_iterator end() const;    // Итератор за последним элементом
+  bool empty() const;            // Проверка, пуст ли список
+  size_type size() const;        // Возвращает размер списка
+  const_iterator insert(const_iterator pos, const_reference value);  // Вставка перед pos
+  void erase(const_iterator pos);         // Удаление элемента
+  void push_back(const_reference value);  // Добавление элемента в конец списка
+  void push_front(const_reference value); // Добавление элемента в начало списка
+  void splice(const_iterator pos, rcu_list& other);  // Перенос элементов другого списка перед pos
+  void clear();        // Удаление всех элементов
+  void synchronize();  // Дождаться читателей и освободить все удалённые узлы
+};
+}  // namespace s21
+
+#include "s21_rcu_list.tpp"  // Подключение реализации шаблонных функций
+
+#endif  // S21_RCU_LIST_H
@@ -0,0 +1,326 @@
+#include <thread>
+
+#include "s21_rcu_list.h"
+
+namespace s21 {
+
+// Конструктор читателя: занимает свободный слот в списке owner.
+// Это единственная операция читателя с атомарным RMW, она выполняется
+// один раз за время жизни дескриптора.
+template <typename T>
+rcu_list<T>::reader::reader(rcu_list& owner) : owner_(&owner), slot_(nullptr) {
+  for (size_type i = 0; i < max_readers && slot_ == nullptr; i++) {
+    bool expected = false;
+    if (owner.readers_[i].in_use_.compare_exchange_strong(expected, true)) {
+      slot_ = &owner.readers_[i];
+    }
+  }
+  // Все слоты заняты: читатель не сможет защитить свои обходы
+  if (slot_ == nullptr) {
+    throw std::length_error("too many readers of rcu_list");
+  }
+}
+
+// Деструктор читателя: выходит из секции чтения (если нужно) и освобождает слот.
+template <typename T>
+rcu_list<T>::reader::~reader() {
+  unlock();
+  slot_->in_use_.store(false, std::memory_order_release);
+}
+
+// Вход в критическую секцию чтения.
+// Читатель публикует в своём слоте текущую эпоху, после чего писатель не
+// освободит ни одного узла, исключённого из списка до этого момента.
+// Барьер не даёт чтению head_ обогнать публикацию эпохи.
+template <typename T>
+void rcu_list<T>::reader::lock() {
+  if (!locked_) {
+    locked_ = true;
+    read_sections_++;
+  }
+  slot_->epoch_.store(owner_->epoch_.load(std::memory_order_acquire),
+                      std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+
+// Выход из критической секции чтения: после него итераторы недействительны.
+template <typename T>
+void rcu_list<T>::reader::unlock() {
+  if (locked_) {
+    locked_ = false;
+    read_sections_--;
+  }
+  slot_->epoch_.store(0, std::memory_order_release);
+}
+
+// Итератор на первый элемент списка; действителен до вызова unlock().
+template <typename T>
+typename rcu_list<T>::const_iterator rcu_list<T>::reader::begin() const {
+  return const_iterator(owner_->head_.load(std::memory_order_acquire));
+}
+
+// Итератор за последним элементом списка.
+template <typename T>
+typename rcu_list<T>::const_iterator rcu_list<T>::reader::end() const {
+  return const_iterator(nullptr);
+}
+
+// Обходит весь список в отдельной секции чтения, вызывая f для каждого элемента.
+// Если f бросает исключение, секция чтения всё равно закрывается.
+template <typename T>
+template <class Function>
+void rcu_list<T>::reader::for_each(Function f) {
+  read_guard guard(*this);
+  for (const_iterator it = begin(); it != end(); ++it) {
+    f(*it);
+  }
+}
+
+// Конструктор списка из списка инициализации.
+template <typename T>
+rcu_list<T>::rcu_list(std::initializer_list<value_type> const& items) {
+  for (const_reference item : items) {
+    push_back(item);
+  }
+}
+
+// Деструктор: освобождает все узлы списка и все отложенные узлы.
+// К моменту разрушения списка все объекты reader должны быть уничтожены.
+template <typename T>
+rcu_list<T>::~rcu_list() {
+  node* current = head_.load(std::memory_order_relaxed);
+  while (current) {
+    node* next = current->next_.load(std::memory_order_relaxed);
+    delete current;
+    current = next;
+  }
+  while (retired_) {
+    node* next = retired_->retired_next_;
+    delete retired_;
+    retired_ = next;
+  }
+}
+
+template <typename T>
+typename rcu_list<T>::const_iterator rcu_list<T>::begin() const {
+  return const_iterator(head_.load(std::memory_order_acquire));
+}
+
+template <typename T>
+typename rcu_list<T>::const_iterator rcu_list<T>::end() const {
+  return const_iterator(nullptr);
+}
+
+template <typename T>
+bool rcu_list<T>::empty() const {
+  return head_.load(std::memory_order_acquire) == nullptr;
+}
+
+template <typename T>
+typename rcu_list<T>::size_type rcu_list<T>::size() const {
+  return size_.load(std::memory_order_relaxed);
+}
+
+// Вставляет готовую цепочку узлов first..last перед узлом pos (nullptr — в конец).
+// Сначала полностью связывается сама цепочка, и только последней release-записью
+// она становится видна читателям: читатель видит либо старый список, либо новый.
+template <typename T>
+void rcu_list<T>::link_before(node* pos, node* first, node* last) {
+  node* prev = pos ? pos->prev_ : tail_;
+  last->next_.store(pos, std::memory_order_relaxed);
+  first->prev_ = prev;
+  if (pos) {
+    pos->prev_ = last;
+  } else {
+    tail_ = last;
+  }
+  if (prev) {
+    prev->next_.store(first, std::memory_order_release);
+  } else {
+    head_.store(first, std::memory_order_release);
+  }
+}
+
+// Ставит узел в очередь на освобождение и при необходимости запускает reclaim().
+// Писатель, который сам находится в секции чтения, освобождение откладывает.
+template <typename T>
+void rcu_list<T>::retire(node* ptr) {
+  ptr->retired_next_ = retired_;
+  retired_ = ptr;
+  retired_count_++;
+  if (retired_count_ >= retire_threshold && read_sections_ == 0) {
+    reclaim();
+  }
+}
+
+// Период ожидания: переводит глобальную эпоху вперёд и ждёт, пока каждый
+// читатель либо выйдет из секции чтения, либо войдёт в неё заново уже в новой
+// эпохе. После этого ни один читатель не может держать указатель на узлы,
+// исключённые из списка до начала ожидания.
+template <typename T>
+void rcu_list<T>::wait_for_readers() {
+  unsigned long target = epoch_.fetch_add(1, std::memory_order_seq_cst) + 1;
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  for (size_type i = 0; i < max_readers; i++) {
+    for (;;) {
+      unsigned long seen = readers_[i].epoch_.load(std::memory_order_acquire);
+      if (seen == 0 || seen >= target) break;
+      std::this_thread::yield();
+    }
+  }
+}
+
+// Освобождает отложенные узлы после периода ожидания.
+// Вызывается писателем под writer_mutex_.
+template <typename T>
+void rcu_list<T>::reclaim() {
+  node* chain = retired_;
+  retired_ = nullptr;
+  retired_count_ = 0;
+  if (chain == nullptr) {
+    return;
+  }
+
+  wait_for_readers();
+  while (chain) {
+    node* next = chain->retired_next_;
+    delete chain;
+    chain = next;
+  }
+}
+
+// Вставляет новый элемент перед pos и возвращает итератор на него.
+template <typename T>
+typename rcu_list<T>::const_iterator rcu_list<T>::insert(
+    const_iterator pos, const_reference value) {
+  node* new_node = new node(value);
+  std::lock_guard<std::mutex> lock(writer_mutex_);
+  link_before(const_cast<node*>(pos.ptr_), new_node, new_node);
+  size_.fetch_add(1, std::memory_order_relaxed);
+  return const_iterator(new_node);
+}
+
+// Исключает элемент из списка. Сам узел продолжает ссылаться на соседа,
+// поэтому читатели, стоящие на нём, спокойно продолжают обход; память
+// освобождается после периода ожидания.
+template <typename T>
+void rcu_list<T>::erase(const_iterator pos) {
+  if (pos.ptr_ == nullptr) {
+    throw std::invalid_argument("invalid argument");
+  }
+  std::lock_guard<std::mutex> lock(writer_mutex_);
+  node* current = const_cast<node*>(pos.ptr_);
+  node* next = current->next_.load(std::memory_order_relaxed);
+  node* prev = current->prev_;
+  if (prev) {
+    prev->next_.store(next, std::memory_order_release);
+  } else {
+    head_.store(next, std::memory_order_release);
+  }
+  if (next) {
+    next->prev_ = prev;
+  } else {
+    tail_ = prev;
+  }
+  size_.fetch_sub(1, std::memory_order_relaxed);
+  retire(current);
+}
+
+template <typename T>
+void rcu_list<T>::push_back(const_reference value) {
+  insert(end(), value);
+}
+
+template <typename T>
+void rcu_list<T>::push_front(const_reference value) {
+  insert(begin(), value);
+}
+
+// Переносит все элементы other перед pos одной публикацией.
+// Перед публикацией выдерживается период ожидания читателей other, чтобы
+// никто из них не стоял на переносимых узлах: иначе такой читатель дошёл бы
+// до хвоста этого списка, а узлы освобождались бы без учёта его секции.
+// Писатель, который сам находится в секции чтения, этого периода не дождётся,
+// поэтому он переносит копии значений, а узлы other откладывает на
+// освобождение, как при erase().
+template <typename T>
+void rcu_list<T>::splice(const_iterator pos, rcu_list& other) {
+  if (&other == this) {
+    return;
+  }
+  std::scoped_lock lock(writer_mutex_, other.writer_mutex_);
+  node* first = other.head_.load(std::memory_order_relaxed);
+  node* last = other.tail_;
+  if (first == nullptr) {
+    return;
+  }
+  const bool copy = read_sections_ != 0;
+  node* copy_first = nullptr;
+  if (copy) {
+    node* copy_last = nullptr;
+    try {
+      for (node* current = first; current;
+           current = current->next_.load(std::memory_order_relaxed)) {
+        node* item = new node(current->value_);
+        item->prev_ = copy_last;
+        if (copy_last) {
+          copy_last->next_.store(item, std::memory_order_relaxed);
+        } else {
+          copy_first = item;
+        }
+        copy_last = item;
+      }
+    } catch (...) {
+      while (copy_first) {
+        node* next = copy_first->next_.load(std::memory_order_relaxed);
+        delete copy_first;
+        copy_first = next;
+      }
+      throw;
+    }
+    std::swap(first, copy_first);
+    last = copy_last;
+  }
+  size_type count = other.size_.exchange(0, std::memory_order_relaxed);
+  other.head_.store(nullptr, std::memory_order_release);
+  other.tail_ = nullptr;
+  if (copy) {
+    // Исходные узлы остаются доступны читателям other до периода ожидания
+    node* current = copy_first;
+    while (current) {
+      node* next = current->next_.load(std::memory_order_relaxed);
+      other.retire(current);
+      current = next;
+    }
+  } else {
+    other.wait_for_readers();
+  }
+  link_before(const_cast<node*>(pos.ptr_), first, last);
+  size_.fetch_add(count, std::memory_order_relaxed);
+}
+
+// Исключает все элементы одной публикацией и откладывает их освобождение.
+template <typename T>
+void rcu_list<T>::clear() {
+  std::lock_guard<std::mutex> lock(writer_mutex_);
+  node* current = head_.load(std::memory_order_relaxed);
+  head_.store(nullptr, std::memory_order_release);
+  tail_ = nullptr;
+  size_.store(0, std::memory_order_relaxed);
+  while (current) {
+    node* next = current->next_.load(std::memory_order_relaxed);
+    retire(current);
+    current = next;
+  }
+}
+
+// Дожидается окончания текущих секций чтения и освобождает все удалённые узлы.
+// Нельзя вызывать из потока, который сам находится в секции чтения.
+template <typename T>
+void rcu_list<T>::synchronize() {
+  assert(read_sections_ == 0 && "synchronize() inside a read section");
+  std::lock_guard<std::mutex> lock(writer_mutex_);
+  reclaim();
+}
+
+}  // namespace s21
@@ -0,0 +1,230 @@
+#ifndef S21_SOA_ARRAY_H
+#define S21_SOA_ARRAY_H
+
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "s21_array.h"
+#include "s21_array_view.h"
+#include "s21_check.h"
+
+namespace s21 {
+inline namespace S21_BOUNDS_ABI {
+
+template <class... Ts>
+class SoaArrayIterator;
+
+// Массив записей, разложенный по столбцам (structure of arrays).
+//
+// Каждое поле Fields хранится в собственном непрерывном буфере s21::array,
+// поэтому проход по одному полю читает только его байты и векторизуется,
+// а копирование, как и у s21::array, разделяет буферы (copy-on-write).
+// Доступ к строке возвращает кортеж ссылок std::tuple<Fields&...>;
+// к столбцу — указатель data<I>() или одномерное представление column<I>().
+// Изменяемый доступ к строкам (operator[], at, begin, end) помечает
+// неразделяемыми все столбцы, data<I>() и column<I>() — только столбец I:
+// пока выданные ссылки живы, копии получают собственные буферы. Когда запись
+// закончена, share() возвращает копированию стоимость O(1).
+template <class... Fields>
+class soa_array {
+  static_assert(sizeof...(Fields) > 0, "soa_array requires at least one field");
+
+ public:
+  using value_type = std::tuple<Fields...>;
+  using reference = std::tuple<Fields &...>;
+  using const_reference = std::tuple<const Fields &...>;
+  using iterator = SoaArrayIterator<Fields...>;
+  using const_iterator = SoaArrayIterator<const Fields...>;
+  using size_type = size_t;
+  template <std::size_t I>
+  using field_type = std::tuple_element_t<I, value_type>;
+
+ private:
+  size_type m_size = 0;
+  std::tuple<array<Fields, 0>...> columns_;  // Столбцы, по одному на поле
+
+  template <std::size_t... I>
+  std::tuple<Fields *...> pointers(std::index_sequence<I...>);
+  template <std::size_t... I>
+  std::tuple<const Fields *...> pointers(std::index_sequence<I...>) const;
+  template <std::size_t... I>
+  void scatter(const value_type *rows, std::index_sequence<I...>);
+  template <std::size_t... I>
+  void fill_columns(const value_type &value, std::index_sequence<I...>);
+
+ public:
+  soa_array() {}
+  explicit soa_array(size_type n) : m_size(n), columns_(array<Fields, 0>(n)...) {}
+  soa_array(std::initializer_list<value_type> const &items);
+  // Раскладывает массив записей по столбцам
+  template <std::size_t Size>
+  explicit soa_array(const array<value_type, Size> &rows);
+
+  // глубокая копия с собственными буферами
+  soa_array clone() const;
+  // Собирает столбцы обратно в массив записей
+  array<value_type, 0> to_array() const;
+
+  // методы для доступа к элементам класса
+  reference at(size_type pos);
+  const_reference at(size_type pos) const;
+  reference operator[](size_type pos);
+  const_reference operator[](size_type pos) const S21_CHECKED_NOEXCEPT;
+
+  // методы для доступа к столбцам
+  template <std::size_t I>
+  field_type<I> *data();
+  template <std::size_t I>
+  const field_type<I> *data() const noexcept;
+  template <std::size_t I>
+  array_view<field_type<I>, 1> column();
+  template <std::size_t I>
+  array_view<const field_type<I>, 1> column() const noexcept;
+
+  //  методы для итерирования по элементам класса
+  iterator begin();
+  iterator end();
+  const_iterator begin() const noexcept;
+  const_iterator end() const noexcept;
+
+  // методы для доступа к информации о наполнении контейнера
+  bool empty() const noexcept { return m_size == 0; }
+  size_type size() const noexcept { return m_size; }
+
+  // методы для изменения контейнера
+  void swap(soa_array &other) noexcept;
+  void fill(const value_type &value);
+  // Запись через выданные ранее ссылки, итераторы и указатели закончена:
+  // следующие копии снова разделяют буферы всех столбцов за O(1)
+  void share() noexcept;
+};
+
+// Итератор по строкам soa_array. Хранит указатели на начала столбцов и номер
+// строки; разыменование даёт кортеж ссылок на поля строки (прокси-ссылку),
+// через который строку можно и прочитать, и записать целиком.
+//
+// Прокси-ссылка — не настоящая ссылка на value_type, поэтому итератор
+// объявлен итератором ввода: алгоритмы, которые переставляют элементы
+// (std::sort, std::reverse, std::swap_ranges), с ним не работают — для них
+// соберите строки через to_array(). Сдвиг, разность и сравнения на порядок
+// доступны как методы и выполняются за O(1).
+template <class... Ts>
+class SoaArrayIterator {
+  template <class...>
+  friend class SoaArrayIterator;
+
+ public:
+  using iterator_category = std::input_iterator_tag;
+  using value_type = std::tuple<std::remove_const_t<Ts>...>;
+  using difference_type = std::ptrdiff_t;
+  using pointer = void;
+  using reference = std::tuple<Ts &...>;
+
+  SoaArrayIterator() noexcept {}
+  SoaArrayIterator(std::tuple<Ts *...> columns, std::size_t index) noexcept
+      : columns_(columns), index_(index) {}
+  // Итератор изменяемого массива приводится к константному
+  template <class... Us,
+            class = std::enable_if_t<std::is_convertible<
+                std::tuple<Us *...>, std::tuple<Ts *...>>::value>>
+  SoaArrayIterator(const SoaArrayIterator<Us...> &other) noexcept
+      : columns_(other.columns_), index_(other.index_) {}
+
+  reference operator*() const noexcept {
+    return deref(std::index_sequence_for<Ts...>());
+  }
+  reference operator[](difference_type n) const noexcept { return *(*this + n); }
+
+  SoaArrayIterator &operator++() noexcept {
+    index_++;
+    return *this;
+  }
+  SoaArrayIterator &operator--() noexcept {
+    index_--;
+    return *this;
+  }
+  SoaArrayIterator operator++(int) noexcept {
+    SoaArrayIterator tmp(*this);
+    index_++;
+    return tmp;
+  }
+  SoaArrayIterator operator--(int) noexcept {
+    SoaArrayIterator tmp(*this);
+    index_--;
+    return tmp;
+  }
+  SoaArrayIterator &operator+=(difference_type n) noexcept {
+    index_ += n;
+    return *this;
+  }
+  SoaArrayIterator &operator-=(difference_type n) noexcept {
+    index_ -= n;
+    return *this;
+  }
+  SoaArrayIterator operator+(difference_type n) const noexcept {
+    return SoaArrayIterator(columns_, index_ + n);
+  }
+  SoaArrayIterator operator-(difference_type n) const noexcept {
+    return SoaArrayIterator(columns_, index_ - n);
+  }
+  difference_type operator-(const SoaArrayIterator &other) const noexcept {
+    check_same(other);
+    return static_cast<difference_type>(index_) -
+           static_cast<difference_type>(other.index_);
+  }
+
+  // Итераторы разных массивов не равны: кроме номера строки сравнивается
+  // начало первого столбца (остальные столбцы принадлежат тому же массиву)
+  bool operator==(const SoaArrayIterator &other) const noexcept {
+    return index_ == other.index_ &&
+           std::get<0>(columns_) == std::get<0>(other.columns_);
+  }
+  bool operator!=(const SoaArrayIterator &other) const noexcept {
+    return !(*this == other);
+  }
+  bool operator<(const SoaArrayIterator &other) const noexcept {
+    check_same(other);
+    return index_ < other.index_;
+  }
+  bool operator>(const SoaArrayIterator &other) const noexcept {
+    check_same(other);
+    return index_ > other.index_;
+  }
+  bool operator<=(const SoaArrayIterator &other) const noexcept {
+    check_same(other);
+    return index_ <= other.index_;
+  }
+  bool operator>=(const SoaArrayIterator &other) const noexcept {
+    check_same(other);
+    return index_ >= other.index_;
+  }
+
+ private:
+  // В режиме S21_CHECK_ASSERT проверяет, что итераторы относятся к одному массиву
+  void check_same(const SoaArrayIterator &other) const noexcept {
+#if S21_BOUNDS_CHECK == S21_CHECK_ASSERT
+    assert(columns_ == other.columns_ && "iterators of different soa_arrays");
+#endif
+    (void)other;
+  }
+
+  template <std::size_t... I>
+  reference deref(std::index_sequence<I...>) const noexcept {
+    return reference(std::get<I>(columns_)[index_]...);
+  }
+
+  std::tuple<Ts *...> columns_;  // Указатели на начала столбцов
+  std::size_t index_ = 0;        // Номер строки
+};
+
+}  // inline namespace S21_BOUNDS_ABI
+}  // namespace s21
+
+#include "s21_soa_array.tpp"
+
+#endif  // S21_SOA_ARRAY_H
@@ -0,0 +1,255 @@
+#include "s21_soa_array.h"
+
+namespace s21 {
+inline namespace S21_BOUNDS_ABI {
+
+/**
+ * @brief Конструктор для инициализации из списка записей.
+ *
+ * Каждая запись раскладывается по столбцам: поле I попадает в столбец I.
+ *
+ * @param items Список записей std::tuple<Fields...>.
+ */
+template <class... Fields>
+soa_array<Fields...>::soa_array(std::initializer_list<value_type> const &items)
+    : soa_array(items.size()) {
+  scatter(items.begin(), std::index_sequence_for<Fields...>());
+}
+
+/**
+ * @brief Раскладывает массив записей по столбцам.
+ *
+ * @param rows Массив записей std::tuple<Fields...>.
+ */
+template <class... Fields>
+template <std::size_t Size>
+soa_array<Fields...>::soa_array(const array<value_type, Size> &rows)
+    : soa_array(rows.size()) {
+  if (m_size) scatter(&rows[0], std::index_sequence_for<Fields...>());
+}
+
+/**
+ * @brief Копирует записи rows[0..size()) в столбцы.
+ *
+ * Столбцы заполняются по очереди, так что запись в каждый из них идёт
+ * последовательно.
+ */
+template <class... Fields>
+template <std::size_t... I>
+void soa_array<Fields...>::scatter(const value_type *rows,
+                                   std::index_sequence<I...>) {
+  auto fill_column = [this, rows](auto *column, auto index) {
+    for (size_type i = 0; i < m_size; i++) {
+      column[i] = std::get<decltype(index)::value>(rows[i]);
+    }
+  };
+  // Столбцы только что созданы и ещё никому не выданы, поэтому пишем прямо
+  // в их буферы, не помечая их неразделяемыми (как сделал бы data<I>())
+  (fill_column(std::get<I>(columns_).arr, std::integral_constant<std::size_t, I>()),
+   ...);
+}
+
+/**
+ * @brief Создаёт глубокую копию массива.
+ *
+ * В отличие от конструктора копирования, который разделяет буферы столбцов,
+ * этот метод сразу копирует каждый столбец в собственный буфер.
+ *
+ * @return Массив с собственными копиями столбцов.
+ */
+template <class... Fields>
+soa_array<Fields...> soa_array<Fields...>::clone() const {
+  soa_array result;
+  result.m_size = m_size;
+  result.columns_ = std::apply(
+      [](const array<Fields, 0> &...columns) {
+        return std::make_tuple(columns.clone()...);
+      },
+      columns_);
+  return result;
+}
+
+/**
+ * @brief Собирает столбцы обратно в массив записей.
+ *
+ * @return Массив записей std::tuple<Fields...> того же размера.
+ */
+template <class... Fields>
+array<typename soa_array<Fields...>::value_type, 0>
+soa_array<Fields...>::to_array() const {
+  array<value_type, 0> rows(m_size);
+  if (m_size) {
+    value_type *out = rows.arr;
+    const_iterator it = begin();
+    for (size_type i = 0; i < m_size; i++, ++it) out[i] = *it;
+  }
+  return rows;
+}
+
+/**
+ * @brief Возвращает ссылки на поля строки с проверкой границ.
+ *
+ * @param pos Номер строки.
+ * @return Кортеж ссылок на поля строки.
+ * @throws std::out_of_range Если номер строки выходит за пределы массива.
+ */
+template <class... Fields>
+typename soa_array<Fields...>::reference soa_array<Fields...>::at(size_type pos) {
+  if (m_size <= pos) {
+    throw std::out_of_range("InvalidIndexError: Index is out of range");
+  }
+  return begin()[pos];
+}
+
+template <class... Fields>
+typename soa_array<Fields...>::const_reference soa_array<Fields...>::at(
+    size_type pos) const {
+  if (m_size <= pos) {
+    throw std::out_of_range("InvalidIndexError: Index is out of range");
+  }
+  return begin()[pos];
+}
+
+/**
+ * @brief Возвращает ссылки на поля строки.
+ *
+ * Проверка номера строки зависит от политики S21_BOUNDS_CHECK (см. s21_check.h).
+ * Изменяемый доступ отделяет все столбцы от общих буферов и помечает их
+ * неразделяемыми до вызова share(), поэтому в горячих циклах лучше брать
+ * указатель на нужный столбец через data<I>().
+ *
+ * @param pos Номер строки.
+ * @return Кортеж ссылок на поля строки.
+ */
+template <class... Fields>
+typename soa_array<Fields...>::reference soa_array<Fields...>::operator[](
+    size_type pos) {
+  detail::check_bounds(pos < m_size, "InvalidIndexError: Index is out of range");
+  return begin()[pos];
+}
+
+template <class... Fields>
+typename soa_array<Fields...>::const_reference soa_array<Fields...>::operator[](
+    size_type pos) const S21_CHECKED_NOEXCEPT {
+  detail::check_bounds(pos < m_size, "InvalidIndexError: Index is out of range");
+  return begin()[pos];
+}
+
+/**
+ * @brief Возвращает указатель на начало столбца I.
+ *
+ * Столбец отделяется от общего буфера и перестаёт разделяться с копиями
+ * (см. copy-on-write в s21::array), поэтому через указатель можно писать.
+ * Для пустого массива — nullptr.
+ */
+template <class... Fields>
+template <std::size_t I>
+typename soa_array<Fields...>::template field_type<I> *
+soa_array<Fields...>::data() {
+  return m_size ? &*std::get<I>(columns_).data() : nullptr;
+}
+
+template <class... Fields>
+template <std::size_t I>
+const typename soa_array<Fields...>::template field_type<I> *
+soa_array<Fields...>::data() const noexcept {
+  return m_size ? &std::get<I>(columns_)[0] : nullptr;
+}
+
+/**
+ * @brief Возвращает столбец I как одномерное представление s21::array_view.
+ */
+template <class... Fields>
+template <std::size_t I>
+array_view<typename soa_array<Fields...>::template field_type<I>, 1>
+soa_array<Fields...>::column() {
+  return array_view<field_type<I>, 1>(data<I>(), {m_size});
+}
+
+template <class... Fields>
+template <std::size_t I>
+array_view<const typename soa_array<Fields...>::template field_type<I>, 1>
+soa_array<Fields...>::column() const noexcept {
+  return array_view<const field_type<I>, 1>(data<I>(), {m_size});
+}
+
+template <class... Fields>
+template <std::size_t... I>
+std::tuple<Fields *...> soa_array<Fields...>::pointers(
+    std::index_sequence<I...>) {
+  return std::tuple<Fields *...>(data<I>()...);
+}
+
+template <class... Fields>
+template <std::size_t... I>
+std::tuple<const Fields *...> soa_array<Fields...>::pointers(
+    std::index_sequence<I...>) const {
+  return std::tuple<const Fields *...>(data<I>()...);
+}
+
+/**
+ * @brief Возвращает итератор на первую строку.
+ *
+ * Столбцы отделяются от общих буферов, так как через итератор можно писать.
+ */
+template <class... Fields>
+typename soa_array<Fields...>::iterator soa_array<Fields...>::begin() {
+  return iterator(pointers(std::index_sequence_for<Fields...>()), 0);
+}
+
+template <class... Fields>
+typename soa_array<Fields...>::iterator soa_array<Fields...>::end() {
+  return iterator(pointers(std::index_sequence_for<Fields...>()), m_size);
+}
+
+template <class... Fields>
+typename soa_array<Fields...>::const_iterator soa_array<Fields...>::begin()
+    const noexcept {
+  return const_iterator(pointers(std::index_sequence_for<Fields...>()), 0);
+}
+
+template <class... Fields>
+typename soa_array<Fields...>::const_iterator soa_array<Fields...>::end()
+    const noexcept {
+  return const_iterator(pointers(std::index_sequence_for<Fields...>()), m_size);
+}
+
+/**
+ * @brief Обменивает содержимое двух массивов за O(1).
+ */
+template <class... Fields>
+void soa_array<Fields...>::swap(soa_array &other) noexcept {
+  std::swap(m_size, other.m_size);
+  // Перемещение s21::array — обмен указателями, поэтому столбцы меняются за O(1)
+  columns_.swap(other.columns_);
+}
+
+/**
+ * @brief Заполняет все строки одной записью: каждый столбец — своим полем.
+ */
+template <class... Fields>
+void soa_array<Fields...>::fill(const value_type &value) {
+  fill_columns(value, std::index_sequence_for<Fields...>());
+}
+
+/**
+ * @brief Снова разрешает копиям разделять буферы столбцов.
+ *
+ * Вызывается, когда запись через ссылки, итераторы и указатели, выданные
+ * изменяемым доступом, закончена (см. array::share()).
+ */
+template <class... Fields>
+void soa_array<Fields...>::share() noexcept {
+  std::apply([](array<Fields, 0> &...columns) { (columns.share(), ...); },
+             columns_);
+}
+
+template <class... Fields>
+template <std::size_t... I>
+void soa_array<Fields...>::fill_columns(const value_type &value,
+                                        std::index_sequence<I...>) {
+  (std::get<I>(columns_).fill(std::get<I>(value)), ...);
+}
+
+}  // inline namespace S21_BOUNDS_ABI
+}  // namespace s21
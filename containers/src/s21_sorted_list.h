@@ -0,0 +1,160 @@
+#ifndef S21_SORTED_LIST_H
+#define S21_SORTED_LIST_H
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+// Отсортированный двусвязный список с индексом в виде списка с пропусками
+// (skip list). Нижний уровень индекса — обычная цепочка next_/prev_ как в
+// s21::list, поэтому обход вперёд и назад стоит столько же, а верхние уровни
+// позволяют искать и вставлять за ожидаемое O(log n) вместо линейного прохода.
+template <class T, class Compare = std::less<T>>
+class sorted_list {
+ public:
+  // Типы, используемые в классе (тип элемента, ссылка на элемент, константная ссылка, размер)
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = std::size_t;
+
+  // Максимальная высота башни узла (хватает для ~4^16 элементов)
+  static constexpr int max_level = 16;
+
+ private:
+  // Связи узла: next(0) — следующий элемент, next(i) — следующий на уровне i.
+  // Башня указателей лежит в том же блоке памяти непосредственно перед узлом
+  // (см. create_node): next(0) соседствует с prev_ и значением, а смещение
+  // уровня не зависит от T, так что служебный узел — это башня без значения.
+  struct node_base {
+    node_base* prev_;  // Указатель на предыдущий узел нижнего уровня
+    int level_;        // Высота башни узла
+
+    node_base*& next(int i) noexcept {
+      return reinterpret_cast<node_base**>(this)[-1 - i];
+    }
+    node_base* next(int i) const noexcept {
+      return reinterpret_cast<node_base* const*>(this)[-1 - i];
+    }
+  };
+
+  // Узел со значением
+  struct node : node_base {
+    value_type value_;  // Значение, которое хранится в узле
+    node(const value_type& value, int level)
+        : node_base{nullptr, level}, value_(value) {}
+  };
+
+  // Размер башни из level указателей, выровненный так, чтобы сразу за ней
+  // можно было разместить объект Block (node или node_base)
+  template <class Block>
+  static std::size_t tower_size(int level) noexcept {
+    std::size_t bytes = static_cast<std::size_t>(level) * sizeof(node_base*);
+    return (bytes + alignof(Block) - 1) / alignof(Block) * alignof(Block);
+  }
+
+  // Служебный узел: начало и конец каждого уровня. Создаётся при первой
+  // вставке, поэтому пустой и перемещённый списки памяти не занимают.
+  node_base* head_ = nullptr;
+  int level_ = 1;              // Текущая высота индекса
+  size_type size_ = 0;         // Размер списка (количество элементов)
+  unsigned long seed_ = 0x9E3779B97F4A7C15UL;  // Состояние генератора высот
+  Compare comp_;               // Функция сравнения
+
+  void init_head();                      // Создание служебного узла (если его ещё нет)
+  void free_head() noexcept;             // Освобождение служебного узла
+  static node* create_node(const value_type& value, int level);  // Узел с башней в одном блоке
+  static void destroy_node(node_base* ptr) noexcept;            // Освобождение такого узла
+  int random_level();                    // Случайная высота новой башни
+  void find_path(const_reference value, node_base** update);  // Предшественники для вставки
+  void link_node(node* new_node);        // Вставка готового узла на своё место
+  void unlink_node(node_base* target);   // Исключение узла из всех уровней
+  static const value_type& value_of(const node_base* ptr) {
+    return static_cast<const node*>(ptr)->value_;
+  }
+
+ public:
+  // Итератор для обхода в обе стороны. Значения только для чтения: их
+  // изменение нарушило бы порядок списка.
+  class sortedIterator {
+   private:
+    node_base* ptr_ = nullptr;  // Указатель на текущий узел
+    friend class sorted_list<T, Compare>;
+
+   public:
+    // Характеристики итератора для алгоритмов стандартной библиотеки
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T*;
+    using reference = const T&;
+
+    sortedIterator() {}
+    explicit sortedIterator(node_base* ptr) : ptr_(ptr) {}
+    reference operator*() const { return value_of(ptr_); }
+    pointer operator->() const { return &value_of(ptr_); }
+    sortedIterator& operator++() {
+      ptr_ = ptr_->next(0);
+      return *this;
+    }
+    sortedIterator operator++(int) {
+      sortedIterator temp = *this;
+      ++(*this);
+      return temp;
+    }
+    sortedIterator& operator--() {
+      ptr_ = ptr_->prev_;
+      return *this;
+    }
+    sortedIterator operator--(int) {
+      sortedIterator temp = *this;
+      --(*this);
+      return temp;
+    }
+    bool operator==(const sortedIterator& other) const { return ptr_ == other.ptr_; }
+    bool operator!=(const sortedIterator& other) const { return ptr_ != other.ptr_; }
+  };
+
+  using iterator = sortedIterator;
+  using const_iterator = sortedIterator;
+
+  sorted_list() noexcept(std::is_nothrow_default_constructible<Compare>::value) {}  // Конструктор по умолчанию
+  sorted_list(std::initializer_list<value_type> const& items);  // Конструктор из списка инициализации
+  sorted_list(const sorted_list& other);  // Конструктор копирования
+  sorted_list(sorted_list&& other) noexcept(
+      std::is_nothrow_move_constructible<Compare>::value);  // Конструктор перемещения
+  ~sorted_list();  // Деструктор
+  sorted_list& operator=(sorted_list&& other) noexcept(
+      std::is_nothrow_swappable<Compare>::value);  // Оператор перемещения
+
+  const_reference front() const;  // Наименьший элемент
+  const_reference back() const;   // Наибольший элемент
+  iterator begin() const;  // Итератор на первый элемент
+  iterator end() const;    // Итератор на элемент после последнего
+  bool empty() const;      // Проверка, пуст ли список
+  size_type size() const;  // Возвращает размер списка
+  void clear();            // Очистка списка
+  void swap(sorted_list& other) noexcept(
+      std::is_nothrow_swappable<Compare>::value);  // Обмен содержимым двух списков
+
+  // Поиск и вставка за ожидаемое O(log n)
+  iterator insert_sorted(const_reference value);  // Вставка с сохранением порядка (после равных)
+  iterator lower_bound(const_reference value) const;  // Первый элемент, не меньший value
+  iterator upper_bound(const_reference value) const;  // Первый элемент, больший value
+  std::pair<iterator, iterator> equal_range(const_reference value) const;  // Диапазон равных value
+  iterator find(const_reference value) const;  // Поиск элемента, равного value
+  size_type erase(const_reference value);  // Удаление всех элементов, равных value
+  iterator erase(iterator pos);  // Удаление элемента по итератору
+  void merge(sorted_list& other);  // Перенос узлов other с сохранением порядка
+};
+}  // namespace s21
+
+#include "s21_sorted_list.tpp"  // Подключение реализации шаблонных функций
+
+#endif  // S21_SORTED_LIST_H
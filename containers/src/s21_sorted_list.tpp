@@ -0,0 +1,370 @@
+#include "s21_sorted_list.h"
+
+namespace s21 {
+
+// Создаёт служебный узел максимальной высоты, если его ещё нет. Он замыкает
+// каждый уровень в кольцо, поэтому служит одновременно началом индекса и
+// итератором end(). Это только башня и связи, без места под значение.
+template <typename T, typename Compare>
+void sorted_list<T, Compare>::init_head() {
+  if (head_) {
+    return;
+  }
+  char* block = static_cast<char*>(
+      ::operator new(tower_size<node_base>(max_level) + sizeof(node_base)));
+  head_ = ::new (block + tower_size<node_base>(max_level))
+      node_base{nullptr, max_level};
+  for (int i = 0; i < max_level; i++) {
+    head_->next(i) = head_;
+  }
+  head_->prev_ = head_;
+  level_ = 1;
+}
+
+template <typename T, typename Compare>
+void sorted_list<T, Compare>::free_head() noexcept {
+  head_->~node_base();
+  ::operator delete(reinterpret_cast<char*>(head_) -
+                    tower_size<node_base>(max_level));
+  head_ = nullptr;
+}
+
+// Создаёт узел высоты level одним выделением памяти: level указателей башни
+// и сразу за ними сам узел.
+template <typename T, typename Compare>
+typename sorted_list<T, Compare>::node* sorted_list<T, Compare>::create_node(
+    const value_type& value, int level) {
+  char* block =
+      static_cast<char*>(::operator new(tower_size<node>(level) + sizeof(node)));
+  try {
+    return ::new (block + tower_size<node>(level)) node(value, level);
+  } catch (...) {
+    ::operator delete(block);
+    throw;
+  }
+}
+
+template <typename T, typename Compare>
+void sorted_list<T, Compare>::destroy_node(node_base* ptr) noexcept {
+  node* target = static_cast<node*>(ptr);
+  char* block = reinterpret_cast<char*>(target) - tower_size<node>(target->level_);
+  target->~node();
+  ::operator delete(block);
+}
+
+// Возвращает высоту башни нового узла: каждый следующий уровень достаётся
+// с вероятностью 1/4 (генератор xorshift, без обращений к глобальному состоянию).
+template <typename T, typename Compare>
+int sorted_list<T, Compare>::random_level() {
+  seed_ ^= seed_ << 13;
+  seed_ ^= seed_ >> 7;
+  seed_ ^= seed_ << 17;
+  unsigned long bits = seed_;
+  int level = 1;
+  while (level < max_level && (bits & 3) == 0) {
+    level++;
+    bits >>= 2;
+  }
+  return level;
+}
+
+// Заполняет update[i] последним узлом уровня i, который не больше value.
+// Новый узел, вставленный после update[], окажется за всеми равными ему.
+template <typename T, typename Compare>
+void sorted_list<T, Compare>::find_path(const_reference value,
+                                        node_base** update) {
+  node_base* current = head_;
+  for (int i = max_level - 1; i >= 0; i--) {
+    if (i < level_) {
+      while (current->next(i) != head_ &&
+             !comp_(value, value_of(current->next(i)))) {
+        current = current->next(i);
+      }
+    }
+    update[i] = current;
+  }
+}
+
+// Вставляет готовый узел на своё место во всех уровнях его башни.
+template <typename T, typename Compare>
+void sorted_list<T, Compare>::link_node(node* new_node) {
+  node_base* update[max_level];
+  find_path(new_node->value_, update);
+  if (new_node->level_ > level_) {
+    level_ = new_node->level_;
+  }
+  for (int i = 0; i < new_node->level_; i++) {
+    new_node->next(i) = update[i]->next(i);
+    update[i]->next(i) = new_node;
+  }
+  new_node->prev_ = update[0];
+  new_node->next(0)->prev_ = new_node;
+  size_++;
+}
+
+// Исключает узел из всех уровней, не освобождая его.
+// Сначала спускаемся к последним узлам, строго меньшим значения, затем на
+// каждом уровне доходим по равным элементам до самого узла.
+template <typename T, typename Compare>
+void sorted_list<T, Compare>::unlink_node(node_base* target) {
+  const value_type& value = value_of(target);
+  node_base* current = head_;
+  for (int i = level_ - 1; i >= 0; i--) {
+    while (current->next(i) != head_ &&
+           comp_(value_of(current->next(i)), value)) {
+      current = current->next(i);
+    }
+    if (i < target->level_) {
+      node_base* prev = current;
+      while (prev->next(i) != target) {
+        prev = prev->next(i);
+      }
+      prev->next(i) = target->next(i);
+    }
+  }
+  target->next(0)->prev_ = target->prev_;
+  while (level_ > 1 && head_->next(level_ - 1) == head_) {
+    level_--;
+  }
+  size_--;
+}
+
+// Конструктор из списка инициализации: элементы вставляются в порядке сортировки.
+template <typename T, typename Compare>
+sorted_list<T, Compare>::sorted_list(
+    std::initializer_list<value_type> const& items) {
+  for (const_reference item : items) {
+    insert_sorted(item);
+  }
+}
+
+// Конструктор копирования: новые узлы с теми же значениями в том же порядке.
+template <typename T, typename Compare>
+sorted_list<T, Compare>::sorted_list(const sorted_list& other)
+    : comp_(other.comp_) {
+  for (iterator it = other.begin(); it != other.end(); ++it) {
+    insert_sorted(*it);
+  }
+}
+
+// Конструктор перемещения: забирает узлы other вместе со служебным узлом,
+// ничего не выделяя. other остаётся пустым и без служебного узла.
+template <typename T, typename Compare>
+sorted_list<T, Compare>::sorted_list(sorted_list&& other) noexcept(
+    std::is_nothrow_move_constructible<Compare>::value)
+    : head_(other.head_),
+      level_(other.level_),
+      size_(other.size_),
+      seed_(other.seed_),
+      comp_(std::move(other.comp_)) {
+  other.head_ = nullptr;
+  other.level_ = 1;
+  other.size_ = 0;
+}
+
+// Деструктор: освобождает все узлы и служебный узел.
+template <typename T, typename Compare>
+sorted_list<T, Compare>::~sorted_list() {
+  if (head_) {
+    clear();
+    free_head();
+  }
+}
+
+// Оператор перемещения: текущие элементы удаляются, узлы other переходят сюда.
+template <typename T, typename Compare>
+sorted_list<T, Compare>& sorted_list<T, Compare>::operator=(
+    sorted_list&& other) noexcept(std::is_nothrow_swappable<Compare>::value) {
+  if (this != &other) {
+    clear();
+    swap(other);
+  }
+  return *this;
+}
+
+// Возвращает наименьший элемент. Бросает исключение, если список пуст.
+template <typename T, typename Compare>
+typename sorted_list<T, Compare>::const_reference
+sorted_list<T, Compare>::front() const {
+  if (empty()) {
+    throw std::out_of_range("sorted_list is empty");
+  }
+  return value_of(head_->next(0));
+}
+
+// Возвращает наибольший элемент. Бросает исключение, если список пуст.
+template <typename T, typename Compare>
+typename sorted_list<T, Compare>::const_reference
+sorted_list<T, Compare>::back() const {
+  if (empty()) {
+    throw std::out_of_range("sorted_list is empty");
+  }
+  return value_of(head_->prev_);
+}
+
+template <typename T, typename Compare>
+typename sorted_list<T, Compare>::iterator sorted_list<T, Compare>::begin()
+    const {
+  return iterator(head_ ? head_->next(0) : nullptr);
+}
+
+template <typename T, typename Compare>
+typename sorted_list<T, Compare>::iterator sorted_list<T, Compare>::end()
+    const {
+  return iterator(head_);
+}
+
+template <typename T, typename Compare>
+bool sorted_list<T, Compare>::empty() const {
+  return size_ == 0;
+}
+
+template <typename T, typename Compare>
+typename sorted_list<T, Compare>::size_type sorted_list<T, Compare>::size()
+    const {
+  return size_;
+}
+
+// Удаляет все элементы, проходя по нижнему уровню.
+template <typename T, typename Compare>
+void sorted_list<T, Compare>::clear() {
+  if (!head_) {
+    return;
+  }
+  node_base* current = head_->next(0);
+  while (current != head_) {
+    node_base* next = current->next(0);
+    destroy_node(current);
+    current = next;
+  }
+  for (int i = 0; i < max_level; i++) {
+    head_->next(i) = head_;
+  }
+  head_->prev_ = head_;
+  level_ = 1;
+  size_ = 0;
+}
+
+template <typename T, typename Compare>
+void sorted_list<T, Compare>::swap(sorted_list& other) noexcept(
+    std::is_nothrow_swappable<Compare>::value) {
+  std::swap(head_, other.head_);
+  std::swap(level_, other.level_);
+  std::swap(size_, other.size_);
+  std::swap(seed_, other.seed_);
+  std::swap(comp_, other.comp_);
+}
+
+// Вставляет value, сохраняя порядок; равные элементы остаются в порядке вставки.
+template <typename T, typename Compare>
+typename sorted_list<T, Compare>::iterator
+sorted_list<T, Compare>::insert_sorted(const_reference value) {
+  init_head();
+  node* new_node = create_node(value, random_level());
+  link_node(new_node);
+  return iterator(new_node);
+}
+
+// Спуск по уровням: на каждом уровне идём вперёд, пока элементы меньше value.
+template <typename T, typename Compare>
+typename sorted_list<T, Compare>::iterator
+sorted_list<T, Compare>::lower_bound(const_reference value) const {
+  if (!head_) {
+    return end();
+  }
+  node_base* current = head_;
+  for (int i = level_ - 1; i >= 0; i--) {
+    while (current->next(i) != head_ &&
+           comp_(value_of(current->next(i)), value)) {
+      current = current->next(i);
+    }
+  }
+  return iterator(current->next(0));
+}
+
+// Спуск по уровням: на каждом уровне идём вперёд, пока элементы не больше value.
+template <typename T, typename Compare>
+typename sorted_list<T, Compare>::iterator
+sorted_list<T, Compare>::upper_bound(const_reference value) const {
+  if (!head_) {
+    return end();
+  }
+  node_base* current = head_;
+  for (int i = level_ - 1; i >= 0; i--) {
+    while (current->next(i) != head_ &&
+           !comp_(value, value_of(current->next(i)))) {
+      current = current->next(i);
+    }
+  }
+  return iterator(current->next(0));
+}
+
+template <typename T, typename Compare>
+std::pair<typename sorted_list<T, Compare>::iterator,
+          typename sorted_list<T, Compare>::iterator>
+sorted_list<T, Compare>::equal_range(const_reference value) const {
+  return std::make_pair(lower_bound(value), upper_bound(value));
+}
+
+// Возвращает итератор на первый элемент, равный value, или end().
+template <typename T, typename Compare>
+typename sorted_list<T, Compare>::iterator sorted_list<T, Compare>::find(
+    const_reference value) const {
+  iterator result = lower_bound(value);
+  if (result != end() && comp_(value, *result)) {
+    result = end();
+  }
+  return result;
+}
+
+// Удаляет все элементы, равные value, и возвращает их количество.
+template <typename T, typename Compare>
+typename sorted_list<T, Compare>::size_type sorted_list<T, Compare>::erase(
+    const_reference value) {
+  size_type count = 0;
+  iterator current = lower_bound(value);
+  while (current != end() && !comp_(value, *current)) {
+    current = erase(current);
+    count++;
+  }
+  return count;
+}
+
+// Удаляет элемент по итератору и возвращает итератор на следующий.
+template <typename T, typename Compare>
+typename sorted_list<T, Compare>::iterator sorted_list<T, Compare>::erase(
+    iterator pos) {
+  if (pos.ptr_ == head_) {
+    throw std::invalid_argument("invalid argument");
+  }
+  node_base* next = pos.ptr_->next(0);
+  unlink_node(pos.ptr_);
+  destroy_node(pos.ptr_);
+  return iterator(next);
+}
+
+// Переносит все узлы other в этот список без копирования значений и без
+// выделения памяти: каждый узел вставляется на своё место вместе со своей
+// башней. Элементы other оказываются после равных им элементов этого списка.
+// После слияния other пуст.
+template <typename T, typename Compare>
+void sorted_list<T, Compare>::merge(sorted_list& other) {
+  if (this == &other || other.empty()) {
+    return;
+  }
+  init_head();
+  node_base* current = other.head_->next(0);
+  while (current != other.head_) {
+    node_base* next = current->next(0);
+    link_node(static_cast<node*>(current));
+    current = next;
+  }
+  for (int i = 0; i < max_level; i++) {
+    other.head_->next(i) = other.head_;
+  }
+  other.head_->prev_ = other.head_;
+  other.level_ = 1;
+  other.size_ = 0;
+}
+
+}  // namespace s21
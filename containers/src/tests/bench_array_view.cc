@@ -0,0 +1,29 @@
+#include <chrono>
+#include <cstdio>
+
+#include "../s21_array_view.h"
+
+// Транспонирование матрицы 4096x4096: построчная копия против copy_tiled().
+
+int main() {
+  const std::size_t n = 4096;
+  s21::array<float, 0> src(n * n), dst(n * n);
+  src.fill(1.0f);
+  dst.fill(0.0f);
+  s21::array_view<float, 2> a(src, {n, n});
+  s21::array_view<float, 2> b(dst, {n, n});
+  s21::array_view<float, 2> bt = b.transposed();
+
+  auto start = std::chrono::steady_clock::now();
+  for (std::size_t i = 0; i < n; i++)
+    for (std::size_t j = 0; j < n; j++) bt(i, j) = a(i, j);
+  auto middle = std::chrono::steady_clock::now();
+  s21::copy_tiled(a, bt);
+  auto stop = std::chrono::steady_clock::now();
+
+  std::printf("naive transpose: %8.2f ms\n",
+              std::chrono::duration<double, std::milli>(middle - start).count());
+  std::printf("tiled transpose: %8.2f ms\n",
+              std::chrono::duration<double, std::milli>(stop - middle).count());
+  return 0;
+}
@@ -0,0 +1,64 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "../s21_list.h"
+
+// Сравнение скорости обхода списка: свежесозданный список, список после
+// долгой череды insert/erase и тот же список после relayout(), а также
+// физический разворот против представления reversed().
+
+static double iterate_ms(s21::list<int>& lst, long long& sum) {
+  auto start = std::chrono::steady_clock::now();
+  for (int round = 0; round < 10; round++) {
+    for (auto it = lst.begin(); it != lst.end(); ++it) sum += *it;
+  }
+  auto stop = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(stop - start).count() / 10;
+}
+
+int main() {
+  const int n = 1000000;
+  long long sum = 0;
+  s21::list<int> lst;
+  for (int i = 0; i < n; i++) lst.insert(lst.end(), i);
+  std::printf("fresh:      %8.2f ms\n", iterate_ms(lst, sum));
+
+  // Перемешиваем узлы: удаляем случайный узел и вставляем его значение
+  // в случайное место, так что соседние по списку узлы оказываются
+  // разбросаны по куче.
+  std::vector<s21::list<int>::iterator> nodes;
+  for (auto it = lst.begin(); it != lst.end(); ++it) nodes.push_back(it);
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<int> pick(0, n - 1);
+  for (int i = 0; i < 2 * n; i++) {
+    int from = pick(gen);
+    int to = pick(gen);
+    if (from == to) continue;
+    int value = *nodes[from];
+    lst.erase(nodes[from]);
+    nodes[from] = lst.insert(nodes[to], value);
+  }
+  std::printf("fragmented: %8.2f ms\n", iterate_ms(lst, sum));
+
+  lst.relayout();
+  std::printf("relayout:   %8.2f ms\n", iterate_ms(lst, sum));
+
+  // Разворот: физический reverse() переставляет связи во всех узлах,
+  // reversed() только создаёт представление для обхода с конца.
+  auto start = std::chrono::steady_clock::now();
+  lst.reverse();
+  auto stop = std::chrono::steady_clock::now();
+  std::printf("reverse():  %8.2f ms\n",
+              std::chrono::duration<double, std::milli>(stop - start).count());
+  start = std::chrono::steady_clock::now();
+  s21::list<int>::reversed_view view = lst.reversed();
+  stop = std::chrono::steady_clock::now();
+  sum += *view.begin();
+  std::printf("reversed(): %8.5f ms\n",
+              std::chrono::duration<double, std::milli>(stop - start).count());
+  std::printf("(checksum %lld)\n", sum);
+  return 0;
+}
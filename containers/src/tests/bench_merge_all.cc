@@ -0,0 +1,52 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "../s21_merge_all.h"
+
+// Слияние k отсортированных списков: k-путевое слияние на куче против
+// склейки всех списков в один с последующей сортировкой.
+
+template <class Function>
+static double time_ms(Function f) {
+  auto start = std::chrono::steady_clock::now();
+  f();
+  auto stop = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+static std::vector<s21::list<int>> make_lists(std::size_t k, std::size_t each) {
+  std::mt19937 gen(42);
+  std::vector<s21::list<int>> lists(k);
+  std::vector<int> values(each);
+  for (s21::list<int>& source : lists) {
+    for (int& value : values) value = static_cast<int>(gen());
+    std::sort(values.begin(), values.end());
+    for (int value : values) source.insert(source.end(), value);
+  }
+  return lists;
+}
+
+int main() {
+  for (std::size_t k : {64, 1024}) {
+    const std::size_t each = 2000000 / k;
+    std::vector<s21::list<int>> lists = make_lists(k, each);
+    std::printf("k = %4zu, concatenate + sort:   %8.1f ms\n", k, time_ms([&]() {
+                  s21::list<int> all;
+                  for (s21::list<int>& source : lists) {
+                    for (auto it = source.begin(); it != source.end(); ++it) {
+                      all.insert(all.end(), *it);
+                    }
+                  }
+                  all.sort();
+                }));
+    std::printf("k = %4zu, merge_all:            %8.1f ms\n", k,
+                time_ms([&]() { s21::merge_all(lists); }));
+    lists = make_lists(k, each);
+    std::printf("k = %4zu, merge_all, 4 threads: %8.1f ms\n", k,
+                time_ms([&]() { s21::merge_all(lists, std::less<int>(), 4); }));
+  }
+  return 0;
+}
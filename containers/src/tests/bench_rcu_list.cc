@@ -0,0 +1,50 @@
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+#include "../s21_rcu_list.h"
+
+// Пропускная способность читателей rcu_list в зависимости от их количества.
+// Параллельно работает писатель, который время от времени вставляет и
+// удаляет элементы. На машине с достаточным числом ядер количество обходов
+// в секунду должно расти линейно с числом читателей.
+
+int main() {
+  s21::rcu_list<int> routes;
+  for (int i = 0; i < 1000; i++) routes.push_back(i);
+
+  unsigned cores = std::thread::hardware_concurrency();
+  std::printf("hardware threads: %u\n", cores);
+  for (int threads = 1; threads <= 8; threads *= 2) {
+    std::atomic<bool> stop{false};
+    std::atomic<long> traversals{0};
+    std::vector<std::thread> readers;
+    for (int t = 0; t < threads; t++) {
+      readers.emplace_back([&]() {
+        s21::rcu_list<int>::reader reader(routes);
+        long local = 0;
+        long sum = 0;
+        while (!stop.load(std::memory_order_relaxed)) {
+          reader.for_each([&sum](int value) { sum += value; });
+          local++;
+        }
+        traversals.fetch_add(local + (sum == -1));
+      });
+    }
+    std::thread writer([&]() {
+      while (!stop.load(std::memory_order_relaxed)) {
+        routes.erase(routes.insert(routes.begin(), -1));
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+      }
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    stop.store(true);
+    for (auto& reader : readers) reader.join();
+    writer.join();
+    std::printf("readers: %d  traversals/s: %10.0f\n", threads,
+                traversals.load() / 0.5);
+  }
+  return 0;
+}
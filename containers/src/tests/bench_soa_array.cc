@@ -0,0 +1,55 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <tuple>
+
+#include "../s21_soa_array.h"
+
+// Проход по одному полю записи {timestamp, price, qty, flags}: массив
+// записей против раскладки по столбцам.
+
+template <class Function>
+static double time_ms(Function f) {
+  auto start = std::chrono::steady_clock::now();
+  f();
+  auto stop = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+using record = std::tuple<std::int64_t, double, std::int32_t, std::int32_t>;
+
+int main() {
+  const std::size_t n = 10000000;
+  const int rounds = 10;
+  s21::array<record, 0> rows(n);
+  for (std::size_t i = 0; i < n; i++) {
+    rows[i] = record(static_cast<std::int64_t>(i), 0.25 * (i % 1000),
+                     static_cast<std::int32_t>(i % 7), 0);
+  }
+  s21::soa_array<std::int64_t, double, std::int32_t, std::int32_t> columns(rows);
+
+  double sum = 0;
+  const record* row = &std::as_const(rows)[0];
+  std::printf("array of records, sum price: %8.2f ms\n", time_ms([&]() {
+                for (int r = 0; r < rounds; r++)
+                  for (std::size_t i = 0; i < n; i++) sum += std::get<1>(row[i]);
+              }) / rounds);
+  const double* price = std::as_const(columns).data<1>();
+  std::printf("soa_array,        sum price: %8.2f ms\n", time_ms([&]() {
+                for (int r = 0; r < rounds; r++)
+                  for (std::size_t i = 0; i < n; i++) sum += price[i];
+              }) / rounds);
+
+  std::int64_t total = 0;
+  std::printf("array of records, sum qty:   %8.2f ms\n", time_ms([&]() {
+                for (int r = 0; r < rounds; r++)
+                  for (std::size_t i = 0; i < n; i++) total += std::get<2>(row[i]);
+              }) / rounds);
+  const std::int32_t* qty = std::as_const(columns).data<2>();
+  std::printf("soa_array,        sum qty:   %8.2f ms\n", time_ms([&]() {
+                for (int r = 0; r < rounds; r++)
+                  for (std::size_t i = 0; i < n; i++) total += qty[i];
+              }) / rounds);
+  std::printf("(checksum %f %lld)\n", sum, static_cast<long long>(total));
+  return 0;
+}
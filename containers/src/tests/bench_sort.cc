@@ -0,0 +1,47 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+
+#include "../s21_array.h"
+#include "../s21_list.h"
+
+// Поразрядная сортировка против сортировки сравнением на 64-битных ключах.
+
+template <class Function>
+static double time_ms(Function f) {
+  auto start = std::chrono::steady_clock::now();
+  f();
+  auto stop = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+int main() {
+  const std::size_t n = 10000000;
+  std::mt19937_64 gen(42);
+
+  s21::array<std::uint64_t, 0> radix(n);
+  for (std::size_t i = 0; i < n; i++) radix[i] = gen();
+  s21::array<std::uint64_t, 0> compare = radix.clone();
+  std::uint64_t* first = &*compare.data();
+  std::printf("array %zu keys, std::sort:  %8.1f ms\n", n,
+              time_ms([&]() { std::sort(first, first + compare.size()); }));
+  std::printf("array %zu keys, radix sort: %8.1f ms\n", n,
+              time_ms([&]() { radix.sort(); }));
+
+  const std::size_t m = 1000000;
+  s21::list<std::uint64_t> list_radix;
+  s21::list<std::uint64_t> list_quick;
+  for (std::size_t i = 0; i < m; i++) {
+    std::uint64_t value = gen();
+    list_radix.insert(list_radix.end(), value);
+    list_quick.insert(list_quick.end(), value);
+  }
+  std::printf("list %zu keys, quick_sort:  %8.1f ms\n", m, time_ms([&]() {
+                list_quick.quick_sort(list_quick.begin(), --list_quick.end());
+              }));
+  std::printf("list %zu keys, radix sort:  %8.1f ms\n", m,
+              time_ms([&]() { list_radix.sort(); }));
+  return 0;
+}
@@ -0,0 +1,187 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include <utility>
+
+#include "../s21_array.h"
+
+TEST(array_test, copy_shares_buffer) {
+  s21::array<int, 5> s21_array{1, 2, 3, 4, 5};
+  s21::array<int, 5> s21_copy(s21_array);
+  const auto& const_array = s21_array;
+  const auto& const_copy = s21_copy;
+  EXPECT_EQ(const_array.begin().operator->(), const_copy.begin().operator->());
+  EXPECT_EQ(const_copy[2], 3);
+}
+
+TEST(array_test, copy_detaches_on_write) {
+  s21::array<int, 3> s21_array{1, 2, 3};
+  s21::array<int, 3> s21_copy(s21_array);
+  s21_copy[0] = 10;
+  EXPECT_EQ(s21_array.at(0), 1);
+  EXPECT_EQ(s21_copy.at(0), 10);
+}
+
+TEST(array_test, copy_detaches_on_fill) {
+  s21::array<int, 3> s21_array{1, 2, 3};
+  s21::array<int, 3> s21_copy = s21_array;
+  s21_copy.fill(7);
+  EXPECT_EQ(std::as_const(s21_array)[1], 2);
+  EXPECT_EQ(std::as_const(s21_copy)[1], 7);
+}
+
+TEST(array_test, copy_detaches_on_iterator) {
+  s21::array<int, 3> s21_array{1, 2, 3};
+  s21::array<int, 3> s21_copy(s21_array);
+  *s21_copy.begin() = 42;
+  EXPECT_EQ(s21_array.front(), 1);
+  EXPECT_EQ(s21_copy.front(), 42);
+}
+
+TEST(array_test, copy_assignment) {
+  s21::array<int, 3> s21_array{1, 2, 3};
+  s21::array<int, 3> s21_copy{4, 5};
+  s21_copy = s21_array;
+  EXPECT_EQ(s21_copy.size(), 3U);
+  EXPECT_EQ(s21_copy.back(), 3);
+}
+
+TEST(array_test, clone) {
+  s21::array<int, 3> s21_array{1, 2, 3};
+  s21::array<int, 3> s21_clone = s21_array.clone();
+  const auto& const_array = s21_array;
+  const auto& const_clone = s21_clone;
+  EXPECT_NE(const_array.begin().operator->(), const_clone.begin().operator->());
+  EXPECT_EQ(const_clone[2], 3);
+}
+
+TEST(array_test, clone_unallocated) {
+  s21::array<int, 3> s21_array;
+  s21::array<int, 3> s21_clone = s21_array.clone();
+  EXPECT_EQ(s21_clone.size(), 3U);
+}
+
+TEST(array_test, copy_after_reference_leak) {
+  s21::array<int, 3> s21_array{1, 2, 3};
+  int& ref = s21_array[0];
+  s21::array<int, 3> s21_snapshot = s21_array;
+  ref = 99;
+  EXPECT_EQ(std::as_const(s21_snapshot)[0], 1);
+  EXPECT_EQ(std::as_const(s21_array)[0], 99);
+}
+
+TEST(array_test, copy_after_iterator_leak) {
+  s21::array<int, 3> s21_array{1, 2, 3};
+  auto it = s21_array.begin();
+  int* ptr = &*s21_array.data();
+  s21::array<int, 3> s21_snapshot(s21_array);
+  *it = 10;
+  ptr[1] = 20;
+  EXPECT_EQ(std::as_const(s21_snapshot)[0], 1);
+  EXPECT_EQ(std::as_const(s21_snapshot)[1], 2);
+  s21::array<int, 3> s21_assigned;
+  s21_assigned = s21_array;
+  *it = 30;
+  EXPECT_EQ(std::as_const(s21_assigned)[0], 10);
+}
+
+TEST(array_test, share_after_writes) {
+  s21::array<int, 100> s21_array(100);
+  for (std::size_t i = 0; i < s21_array.size(); i++) s21_array[i] = static_cast<int>(i);
+  s21_array.share();
+  s21::array<int, 100> s21_snapshot = s21_array;
+  EXPECT_EQ(std::as_const(s21_array).begin().operator->(),
+            std::as_const(s21_snapshot).begin().operator->());
+  // Следующая запись снова отделяет массив от снимка
+  s21_array[0] = -1;
+  EXPECT_EQ(std::as_const(s21_snapshot)[0], 0);
+  EXPECT_NE(std::as_const(s21_array).begin().operator->(),
+            std::as_const(s21_snapshot).begin().operator->());
+}
+
+TEST(array_test, copy_to_thread) {
+  s21::array<int, 1000> s21_array(1000);
+  s21_array.fill(1);
+  long sum = 0;
+  std::thread reader([snapshot = s21_array, &sum]() {
+    for (auto it = snapshot.begin(); it != snapshot.end(); ++it) sum += *it;
+  });
+  s21_array.fill(2);
+  reader.join();
+  EXPECT_EQ(sum, 1000);
+  EXPECT_EQ(s21_array.back(), 2);
+}
+
+TEST(array_test, sort_radix) {
+  std::mt19937_64 gen(1);
+  s21::array<std::int64_t, 5000> s21_array(5000);
+  std::vector<std::int64_t> std_vector(5000);
+  for (std::size_t i = 0; i < 5000; i++) {
+    std_vector[i] = static_cast<std::int64_t>(gen());
+    s21_array[i] = std_vector[i];
+  }
+  s21::array<std::int64_t, 5000> s21_copy(s21_array);
+  s21_array.sort();
+  std::sort(std_vector.begin(), std_vector.end());
+  EXPECT_TRUE(std::equal(std_vector.begin(), std_vector.end(),
+                         std::as_const(s21_array).begin()));
+  EXPECT_EQ(std::as_const(s21_copy)[0], static_cast<std::int64_t>(std::mt19937_64(1)()));
+}
+
+TEST(array_test, sort_float) {
+  s21::array<float, 6> s21_array{2.5f, -1.0f, 0.0f, -7.25f, 3.0f, -0.5f};
+  s21_array.sort();
+  std::vector<float> expected{-7.25f, -1.0f, -0.5f, 0.0f, 2.5f, 3.0f};
+  EXPECT_TRUE(std::equal(expected.begin(), expected.end(),
+                         std::as_const(s21_array).begin()));
+}
+
+TEST(array_test, sort_long_double) {
+  s21::array<long double, 5> s21_array{2.5L, -1.0L, 0.0L, -7.25L, 3.0L};
+  s21_array.sort();
+  std::vector<long double> expected{-7.25L, -1.0L, 0.0L, 2.5L, 3.0L};
+  EXPECT_TRUE(std::equal(expected.begin(), expected.end(),
+                         std::as_const(s21_array).begin()));
+}
+
+TEST(array_test, sort_by_key) {
+  s21::array<std::pair<int, char>, 4> s21_array{{3, 'a'}, {1, 'b'}, {3, 'c'}, {2, 'd'}};
+  s21_array.sort_by_key([](const std::pair<int, char>& item) { return item.first; });
+  EXPECT_EQ(s21_array[0].second, 'b');
+  EXPECT_EQ(s21_array[1].second, 'd');
+  EXPECT_EQ(s21_array[2].second, 'a');
+  EXPECT_EQ(s21_array[3].second, 'c');
+}
+
+TEST(array_test, move_is_noexcept) {
+  static_assert(std::is_nothrow_move_constructible<s21::array<int, 3>>::value,
+                "array move constructor should be noexcept");
+  static_assert(noexcept(std::declval<s21::array<int, 3>&>().swap(
+                    std::declval<s21::array<int, 3>&>())),
+                "array swap should be noexcept");
+  s21::array<int, 3> s21_array{1, 2, 3};
+  s21::array<int, 3> s21_moved(std::move(s21_array));
+  EXPECT_EQ(s21_moved.size(), 3U);
+  EXPECT_EQ(s21_moved.back(), 3);
+}
+
+#if S21_BOUNDS_CHECK == S21_CHECK_THROW
+TEST(array_test, index_throw) {
+  s21::array<int, 3> s21_array{1, 2, 3};
+  EXPECT_THROW(s21_array[3], std::out_of_range);
+  EXPECT_THROW(std::as_const(s21_array)[3], std::out_of_range);
+  EXPECT_NO_THROW(s21_array.at(2));
+}
+#else
+TEST(array_test, index_noexcept) {
+  static_assert(noexcept(std::declval<const s21::array<int, 3>&>()[0]),
+                "unchecked const operator[] should be noexcept");
+  s21::array<int, 3> s21_array{1, 2, 3};
+  EXPECT_THROW(s21_array.at(3), std::out_of_range);
+}
+#endif
@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+
+#include <utility>
+#include <vector>
+
+#include "../s21_array_view.h"
+
+TEST(array_view_test, row_major) {
+  s21::array<int, 6> s21_array{1, 2, 3, 4, 5, 6};
+  s21::array_view<int, 2> view(s21_array, {2, 3});
+  EXPECT_EQ(view(0, 2), 3);
+  EXPECT_EQ(view(1, 0), 4);
+  EXPECT_EQ(view.size(), 6U);
+  EXPECT_TRUE(view.is_contiguous());
+  view(1, 1) = 50;
+  EXPECT_EQ(s21_array.at(4), 50);
+}
+
+TEST(array_view_test, column_major) {
+  s21::array<int, 6> s21_array{1, 2, 3, 4, 5, 6};
+  s21::array_view<int, 2> view(s21_array, {2, 3}, s21::layout::column_major);
+  EXPECT_EQ(view(1, 0), 2);
+  EXPECT_EQ(view(0, 2), 5);
+  EXPECT_TRUE(view.is_contiguous());
+}
+
+TEST(array_view_test, at_throw) {
+  s21::array<int, 6> s21_array{1, 2, 3, 4, 5, 6};
+  s21::array_view<int, 2> view(s21_array, {2, 3});
+  EXPECT_EQ(view.at(1, 2), 6);
+  EXPECT_THROW(view.at(2, 0), std::out_of_range);
+  EXPECT_THROW((s21::array_view<int, 2>(s21_array, {3, 3})), std::out_of_range);
+}
+
+TEST(array_view_test, subview_and_strided) {
+  s21::array<int, 16> s21_array(16);
+  for (int i = 0; i < 16; i++) s21_array[i] = i;
+  s21::array_view<int, 2> view(s21_array, {4, 4});
+  auto block = view.subview({1, 1}, {2, 2});
+  EXPECT_EQ(block(0, 0), 5);
+  EXPECT_EQ(block(1, 1), 10);
+  EXPECT_FALSE(block.is_contiguous());
+  auto even_cols = view.strided(1, 2);
+  EXPECT_EQ(even_cols.extent(1), 2U);
+  EXPECT_EQ(even_cols(2, 1), 10);
+  EXPECT_THROW(view.subview({3, 0}, {2, 1}), std::out_of_range);
+}
+
+TEST(array_view_test, slice_and_transpose) {
+  s21::array<int, 6> s21_array{1, 2, 3, 4, 5, 6};
+  s21::array_view<int, 2> view(s21_array, {2, 3});
+  auto row = view.slice(0, 1);
+  auto col = view.slice(1, 2);
+  EXPECT_EQ(row(2), 6);
+  EXPECT_EQ(col(0), 3);
+  EXPECT_EQ(col(1), 6);
+  auto t = view.transposed();
+  EXPECT_EQ(t.extent(0), 3U);
+  EXPECT_EQ(t(2, 1), 6);
+}
+
+TEST(array_view_test, copy_tiled_transpose) {
+  const std::size_t rows = 37, cols = 53;
+  std::vector<double> src(rows * cols), dst(rows * cols);
+  for (std::size_t i = 0; i < src.size(); i++) src[i] = i;
+  s21::array_view<double, 2> a(src.data(), {rows, cols});
+  s21::array_view<double, 2> b(dst.data(), {cols, rows});
+  s21::copy_tiled(a, b.transposed());
+  bool result = true;
+  for (std::size_t i = 0; i < rows; i++)
+    for (std::size_t j = 0; j < cols; j++)
+      if (b(j, i) != a(i, j)) result = false;
+  EXPECT_TRUE(result);
+}
+
+TEST(array_view_test, for_each_tile_visits_all) {
+  std::vector<int> data(7 * 5, 0);
+  s21::array_view<int, 2> view(data.data(), {7, 5});
+  s21::for_each_tile(view, 3, 2, [](std::size_t, std::size_t, int& value) {
+    value++;
+  });
+  bool result = true;
+  for (int value : data) result = result && value == 1;
+  EXPECT_TRUE(result);
+}
+
+TEST(array_view_test, array_copy_after_view) {
+  s21::array<int, 4> source{1, 2, 3, 4};
+  s21::array_view<int, 2> view(source, {2, 2});
+  s21::array<int, 4> snapshot = source;
+  view(0, 0) = 99;
+  EXPECT_EQ(std::as_const(snapshot)[0], 1);
+  EXPECT_EQ(std::as_const(source)[0], 99);
+}
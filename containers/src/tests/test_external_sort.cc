@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "../s21_external_sort.h"
+#include "test_fixtures.h"
+
+using s21_test::record;
+
+TEST(external_sort_test, fits_in_memory) {
+  std::vector<int> input{5, 3, 9, 1, 3};
+  std::size_t pos = 0;
+  s21::list<int> result = s21::external_sort<int>([&](int& value) {
+    if (pos == input.size()) return false;
+    value = input[pos++];
+    return true;
+  });
+  std::sort(input.begin(), input.end());
+  EXPECT_EQ(result.size(), input.size());
+  EXPECT_TRUE(std::equal(input.begin(), input.end(), result.begin()));
+}
+
+TEST(external_sort_test, many_runs_multi_pass) {
+  std::mt19937 gen(3);
+  std::vector<int> input(20000);
+  for (int& value : input) value = gen() % 1000;
+  std::size_t pos = 0;
+  s21::external_sort_options options;
+  options.memory_budget = 16 * 1024;
+  options.merge_fan_in = 4;
+  options.temp_dir = std::filesystem::temp_directory_path().string();
+  std::vector<int> output;
+  s21::external_sort<int>(
+      [&](int& value) {
+        if (pos == input.size()) return false;
+        value = input[pos++];
+        return true;
+      },
+      [&output](const int& value) { output.push_back(value); }, options);
+  std::sort(input.begin(), input.end());
+  EXPECT_EQ(output, input);
+}
+
+TEST(external_sort_test, stable_records) {
+  std::mt19937 gen(5);
+  std::vector<record> input(5000);
+  for (int i = 0; i < 5000; i++) input[i] = record(static_cast<int>(gen() % 50), i);
+  std::size_t pos = 0;
+  s21::external_sort_options options;
+  options.memory_budget = 8 * 1024;
+  std::vector<record> output;
+  s21::external_sort<record>(
+      [&](record& value) {
+        if (pos == input.size()) return false;
+        value = input[pos++];
+        return true;
+      },
+      [&output](const record& value) { output.push_back(value); }, options);
+  std::stable_sort(input.begin(), input.end());
+  ASSERT_EQ(output.size(), input.size());
+  bool result = true;
+  for (std::size_t i = 0; i < input.size(); i++) {
+    result = result && output[i].key == input[i].key &&
+             output[i].order == input[i].order;
+  }
+  EXPECT_TRUE(result);
+}
+
+TEST(external_sort_test, bad_temp_dir) {
+  int count = 0;
+  s21::external_sort_options options;
+  options.memory_budget = 1024;
+  options.temp_dir = "/nonexistent/s21";
+  EXPECT_THROW(s21::external_sort<int>(
+                   [&count](int& value) {
+                     value = count;
+                     return count++ < 1000;
+                   },
+                   options),
+               std::runtime_error);
+}
+
+TEST(external_sort_test, parallel_sorts_share_temp_dir) {
+  std::vector<std::vector<int>> outputs(4);
+  std::vector<std::thread> threads;
+  for (std::size_t t = 0; t < outputs.size(); t++) {
+    threads.emplace_back([&outputs, t] {
+      int count = 0;
+      s21::external_sort_options options;
+      options.memory_budget = 4 * 1024;
+      s21::external_sort<int>(
+          [&count](int& value) {
+            value = (count * 7919) % 3000;
+            return count++ < 3000;
+          },
+          [&outputs, t](const int& value) { outputs[t].push_back(value); },
+          options);
+    });
+  }
+  for (std::thread& thread : threads) thread.join();
+  std::vector<int> expected(3000);
+  for (int i = 0; i < 3000; i++) expected[i] = i;
+  for (const std::vector<int>& output : outputs) EXPECT_EQ(output, expected);
+}
+
+TEST(external_sort_test, throw_removes_runs) {
+  std::filesystem::path dir =
+      std::filesystem::temp_directory_path() / "s21_external_sort_test";
+  std::filesystem::create_directories(dir);
+  int count = 0;
+  s21::external_sort_options options;
+  options.memory_budget = 1024;
+  options.temp_dir = dir.string();
+  EXPECT_THROW(s21::external_sort<int>(
+                   [&count](int& value) {
+                     if (count == 5000) throw std::runtime_error("source failed");
+                     value = count++;
+                     return true;
+                   },
+                   options),
+               std::runtime_error);
+  EXPECT_TRUE(std::filesystem::is_empty(dir));
+  std::filesystem::remove(dir);
+}
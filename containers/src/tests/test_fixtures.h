@@ -0,0 +1,21 @@
+#ifndef S21_TEST_FIXTURES_H
+#define S21_TEST_FIXTURES_H
+
+#include <cstddef>
+
+namespace s21_test {
+
+// Запись с ключом сортировки и исходным номером — для проверки устойчивости
+struct record {
+  int key;
+  int order;
+  record() = default;
+  record(int k, int o) : key(k), order(o) {}
+  // s21::list хранит размер в служебном узле, поэтому T строится из size_t
+  record(std::size_t) : key(0), order(0) {}
+  bool operator<(const record& other) const { return key < other.key; }
+};
+
+}  // namespace s21_test
+
+#endif  // S21_TEST_FIXTURES_H
@@ -1,8 +1,13 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <iostream>
 #include <list>
+#include <random>
+#include <stdexcept>
 #include <string>
+#include <type_traits>
+#include <vector>
 
 #include "../s21_list.h"
 
@@ -119,6 +124,8 @@ TEST(list_test, begin) {
   EXPECT_EQ(*s21_list.begin(), *std_list.begin());
 }
 
+// В режиме S21_CHECK_ASSERT разыменование end() останавливает программу
+#if S21_BOUNDS_CHECK != S21_CHECK_ASSERT
 TEST(list_test, begin_throw) {
   s21::list<int> s21_list;
   std::list<int> std_list;
@@ -136,6 +143,7 @@ TEST(list_test, end_empty) {
   std::list<int> std_list;
   EXPECT_EQ(*s21_list.end(), *std_list.end());
 }
+#endif
 
 TEST(list_test, empty) {
   s21::list<int> s21_list;
@@ -596,6 +604,343 @@ TEST(list_test, sort) {
   EXPECT_TRUE(result);
 }
 
+TEST(list_test, sort_radix_signed) {
+  std::mt19937 gen(11);
+  s21::list<int> s21_list;
+  std::list<int> std_list;
+  for (int i = 0; i < 1000; i++) {
+    int value = static_cast<int>(gen() % 2001) - 1000;
+    s21_list.insert(s21_list.begin(), value);
+    std_list.push_front(value);
+  }
+  s21_list.sort();
+  std_list.sort();
+  EXPECT_EQ(s21_list.size(), std_list.size());
+  EXPECT_EQ(s21_list.front(), std_list.front());
+  EXPECT_EQ(s21_list.back(), std_list.back());
+  auto s21_iterator = s21_list.begin();
+  auto std_iterator = std_list.begin();
+  bool result = true;
+  for (size_t i = 0; i < s21_list.size(); i++) {
+    if (*s21_iterator != *std_iterator) {
+      result = false;
+      break;
+    }
+    s21_iterator++;
+    std_iterator++;
+  }
+  EXPECT_TRUE(result);
+  EXPECT_EQ(*--s21_list.end(), std_list.back());
+}
+
+TEST(list_test, sort_radix_double) {
+  s21::list<double> s21_list;
+  std::list<double> std_list;
+  for (int i = 0; i < 200; i++) {
+    double value = (i % 7 - 3) * 1.5 / (i + 1);
+    s21_list.insert(s21_list.end(), value);
+    std_list.push_back(value);
+  }
+  s21_list.sort();
+  std_list.sort();
+  auto s21_iterator = s21_list.begin();
+  auto std_iterator = std_list.begin();
+  bool result = true;
+  for (size_t i = 0; i < s21_list.size(); i++) {
+    if (*s21_iterator != *std_iterator) {
+      result = false;
+      break;
+    }
+    s21_iterator++;
+    std_iterator++;
+  }
+  EXPECT_TRUE(result);
+}
+
+TEST(list_test, sort_long_double) {
+  s21::list<long double> s21_list;
+  std::list<long double> std_list;
+  for (int i = 0; i < 200; i++) {
+    long double value = (i % 11 - 5) * 2.5L / (i + 1);
+    s21_list.insert(s21_list.end(), value);
+    std_list.push_back(value);
+  }
+  s21_list.sort();
+  std_list.sort();
+  EXPECT_TRUE(std::equal(std_list.begin(), std_list.end(), s21_list.begin()));
+}
+
+TEST(list_test, sort_iterator_semantics) {
+  s21::list<int> s21_values;
+  for (int i = 100; i > 0; i--) s21_values.push_back(i);
+  auto value_it = s21_values.begin();
+  s21_values.sort();
+  // Поразрядная сортировка значений: итератор остался на первой позиции
+  EXPECT_EQ(*value_it, 1);
+
+  s21::list<int> s21_keys;
+  for (int i = 100; i > 0; i--) s21_keys.push_back(i);
+  auto key_it = s21_keys.begin();
+  s21_keys.sort_by_key([](int value) { return value; });
+  // Перешивка узлов: итератор следует за своим элементом
+  EXPECT_EQ(*key_it, 100);
+  EXPECT_EQ(*--s21_keys.end(), 100);
+}
+
+TEST(list_test, sort_by_key_throw) {
+  s21::list<int> s21_list{3, 1, 2};
+  EXPECT_THROW(s21_list.sort_by_key([](int value) {
+    if (value == 2) throw std::runtime_error("bad key");
+    return value;
+  }),
+               std::runtime_error);
+  std::list<int> std_list{3, 1, 2};
+  EXPECT_TRUE(std::equal(std_list.begin(), std_list.end(), s21_list.begin()));
+}
+
+TEST(list_test, sort_by_key) {
+  s21::list<int> s21_list{15, 21, 34, 42, 50, 63};
+  // Сортировка по последней цифре, равные ключи сохраняют порядок
+  s21_list.sort_by_key([](int value) { return value % 10; });
+  std::list<int> std_list{50, 21, 42, 63, 34, 15};
+  auto s21_iterator = s21_list.begin();
+  auto std_iterator = std_list.begin();
+  bool result = true;
+  for (size_t i = 0; i < s21_list.size(); i++) {
+    if (*s21_iterator != *std_iterator) {
+      result = false;
+      break;
+    }
+    s21_iterator++;
+    std_iterator++;
+  }
+  EXPECT_TRUE(result);
+}
+
+TEST(list_test, relayout) {
+  s21::list<int> s21_list{4, 2, 5, 1, 9};
+  std::list<int> std_list{4, 2, 5, 1, 9};
+  s21_list.insert(s21_list.begin(), 7);
+  std_list.insert(std_list.begin(), 7);
+  s21_list.erase(s21_list[3]);
+  std_list.erase(std::next(std_list.begin(), 3));
+  s21_list.relayout();
+  EXPECT_EQ(s21_list.size(), std_list.size());
+  auto s21_iterator = s21_list.begin();
+  auto std_iterator = std_list.begin();
+  bool result = true;
+  for (size_t i = 0; i < s21_list.size(); i++) {
+    if (*s21_iterator != *std_iterator) {
+      result = false;
+      break;
+    }
+    s21_iterator++;
+    std_iterator++;
+  }
+  EXPECT_TRUE(result);
+  EXPECT_EQ(s21_list.front(), std_list.front());
+  EXPECT_EQ(s21_list.back(), std_list.back());
+}
+
+TEST(list_test, relayout_then_modify) {
+  s21::list<int> s21_list{1, 2, 3, 4};
+  std::list<int> std_list{1, 2, 3, 4};
+  s21_list.relayout();
+  s21_list.erase(s21_list.begin());
+  std_list.erase(std_list.begin());
+  s21_list.insert(s21_list.end(), 5);
+  std_list.insert(std_list.end(), 5);
+  s21_list.relayout();
+  s21_list.erase(--s21_list.end());
+  std_list.erase(--std_list.end());
+  EXPECT_EQ(s21_list.size(), std_list.size());
+  auto s21_iterator = s21_list.begin();
+  auto std_iterator = std_list.begin();
+  bool result = true;
+  for (size_t i = 0; i < s21_list.size(); i++) {
+    if (*s21_iterator != *std_iterator) {
+      result = false;
+      break;
+    }
+    s21_iterator++;
+    std_iterator++;
+  }
+  EXPECT_TRUE(result);
+}
+
+TEST(list_test, relayout_empty) {
+  s21::list<int> s21_list;
+  s21_list.relayout();
+  EXPECT_TRUE(s21_list.empty());
+  EXPECT_TRUE(s21_list.begin() == s21_list.end());
+}
+
+namespace {
+// Значение, копирование которого бросает исключение после заданного числа копий
+struct fragile {
+  static inline int copies_left = -1;
+  int value;
+  fragile(std::size_t v = 0) : value(static_cast<int>(v)) {}
+  fragile(const fragile& other) : value(other.value) {
+    if (copies_left == 0) throw std::runtime_error("copy failed");
+    if (copies_left > 0) copies_left--;
+  }
+  fragile& operator=(const fragile&) = default;
+};
+}  // namespace
+
+TEST(list_test, relayout_throw_keeps_list) {
+  s21::list<fragile> s21_list;
+  for (std::size_t i = 0; i < 10; i++) s21_list.push_back(fragile(i));
+  fragile::copies_left = 5;
+  EXPECT_THROW(s21_list.relayout(), std::runtime_error);
+  fragile::copies_left = -1;
+  EXPECT_EQ(s21_list.size(), 10U);
+  int expected = 0;
+  bool result = true;
+  for (auto it = s21_list.begin(); it != s21_list.end(); ++it) {
+    result = result && (*it).value == expected++;
+  }
+  EXPECT_TRUE(result);
+  s21_list.relayout();
+  EXPECT_EQ(s21_list.back().value, 9);
+}
+
+TEST(list_test, move_is_noexcept) {
+  static_assert(std::is_nothrow_move_constructible<s21::list<int>>::value,
+                "list move constructor should be noexcept");
+  static_assert(std::is_nothrow_move_assignable<s21::list<int>>::value,
+                "list move assignment should be noexcept");
+  std::vector<s21::list<int>> lists;
+  for (int i = 0; i < 20; i++) lists.push_back(s21::list<int>{i, i + 1});
+  EXPECT_EQ(lists[0].front(), 0);
+  EXPECT_EQ(lists[19].back(), 20);
+}
+
+TEST(list_test, move_leaves_usable_list) {
+  s21::list<int> s21_list{1, 2, 3};
+  s21::list<int> s21_moved(std::move(s21_list));
+  EXPECT_EQ(s21_moved.size(), 3U);
+  EXPECT_EQ(*--s21_moved.end(), 3);
+  EXPECT_TRUE(s21_list.begin() == s21_list.end());
+  s21_list.insert(s21_list.end(), 7);
+  EXPECT_EQ(s21_list.front(), 7);
+  EXPECT_TRUE(++s21_list.begin() == s21_list.end());
+  s21_moved = std::move(s21_list);
+  EXPECT_EQ(s21_moved.size(), 1U);
+  EXPECT_EQ(s21_moved.back(), 7);
+}
+
+TEST(list_test, moved_from_merge_splice) {
+  s21::list<int> s21_source{1, 5, 9};
+  s21::list<int> s21_moved(std::move(s21_source));
+  s21::list<int> s21_other{2, 3};
+  s21_source.merge(s21_other);
+  s21_source.insert(s21_source.begin(), 0);
+  s21::list<int> s21_tail{7, 8};
+  s21_source.splice(s21_source.begin(), s21_tail);
+  std::list<int> std_list{7, 8, 0, 2, 3};
+  EXPECT_EQ(s21_source.size(), std_list.size());
+  EXPECT_TRUE(std::equal(std_list.begin(), std_list.end(), s21_source.begin()));
+  // Слияние, в котором второй список заканчивается раньше первого
+  s21::list<int> s21_short{4};
+  s21_moved.merge(s21_short);
+  std::list<int> std_moved{1, 4, 5, 9};
+  EXPECT_EQ(s21_moved.size(), std_moved.size());
+  EXPECT_TRUE(std::equal(std_moved.begin(), std_moved.end(), s21_moved.begin()));
+}
+
+TEST(list_test, moved_from_stale_end) {
+  s21::list<int> s21_source{1, 2};
+  s21::list<int> s21_moved(std::move(s21_source));
+  // end() перемещённого списка взят до того, как появился служебный узел
+  s21::list<int>::iterator s21_end = s21_source.end();
+  s21_source.insert(s21_end, 3);
+  s21_source.insert(s21_end, 4);
+  std::list<int> std_list{3, 4};
+  EXPECT_EQ(s21_source.size(), std_list.size());
+  EXPECT_TRUE(std::equal(std_list.begin(), std_list.end(), s21_source.begin()));
+  EXPECT_EQ(*--s21_source.end(), 4);
+}
+
+#if S21_BOUNDS_CHECK == S21_CHECK_THROW
+TEST(list_test, front_empty_throw) {
+  s21::list<int> s21_list;
+  EXPECT_THROW(s21_list.front(), std::out_of_range);
+  EXPECT_THROW(s21_list.back(), std::out_of_range);
+}
+#endif
+
+TEST(list_test, reverse_keeps_both_directions) {
+  s21::list<int> s21_list{1, 2, 3, 4, 5};
+  s21_list.reverse();
+  std::vector<int> forward;
+  for (auto it = s21_list.begin(); it != s21_list.end(); ++it) forward.push_back(*it);
+  std::vector<int> backward(s21_list.rbegin(), s21_list.rend());
+  EXPECT_EQ(forward, (std::vector<int>{5, 4, 3, 2, 1}));
+  EXPECT_EQ(backward, (std::vector<int>{1, 2, 3, 4, 5}));
+  EXPECT_EQ(s21_list.front(), 5);
+  EXPECT_EQ(s21_list.back(), 1);
+  s21_list.insert(s21_list.end(), 0);
+  EXPECT_EQ(*--s21_list.end(), 0);
+  EXPECT_EQ(*s21_list.rbegin(), 0);
+}
+
+TEST(list_test, rbegin_rend) {
+  s21::list<int> s21_list;
+  EXPECT_TRUE(s21_list.rbegin() == s21_list.rend());
+  s21_list.push_back(2);
+  s21_list.push_back(3);
+  s21_list.push_front(1);
+  std::list<int> std_list{1, 2, 3};
+  EXPECT_TRUE(std::equal(std_list.rbegin(), std_list.rend(), s21_list.rbegin()));
+  auto it = s21_list.rbegin();
+  *it = 30;
+  EXPECT_EQ(s21_list.back(), 30);
+  ++it;
+  --it;
+  EXPECT_EQ(*it, 30);
+  s21_list.pop_back();
+  EXPECT_EQ(*s21_list.rbegin(), 2);
+  s21_list.erase(s21_list.begin());
+  s21_list.erase(s21_list.begin());
+  EXPECT_TRUE(s21_list.empty());
+  EXPECT_TRUE(s21_list.rbegin() == s21_list.rend());
+}
+
+TEST(list_test, reversed_view) {
+  s21::list<int> s21_list{1, 2, 3};
+  std::vector<int> values;
+  for (int& value : s21_list.reversed()) values.push_back(value);
+  EXPECT_EQ(values, (std::vector<int>{3, 2, 1}));
+  EXPECT_EQ(s21_list.reversed().size(), 3U);
+  EXPECT_EQ(s21_list.front(), 1);
+}
+
+TEST(list_test, const_reverse_iteration) {
+  const s21::list<int> s21_list{1, 2, 3};
+  const std::list<int> std_list{1, 2, 3};
+  std::vector<int> backward(s21_list.rbegin(), s21_list.rend());
+  EXPECT_EQ(backward, (std::vector<int>{3, 2, 1}));
+  EXPECT_TRUE(std::equal(std_list.crbegin(), std_list.crend(), s21_list.crbegin()));
+  static_assert(std::is_same<decltype(*s21_list.rbegin()), const int&>::value,
+                "const list must yield const references");
+  std::vector<int> values;
+  for (const int& value : s21_list.reversed()) values.push_back(value);
+  EXPECT_EQ(values, backward);
+  EXPECT_EQ(s21_list.reversed().size(), 3U);
+
+  s21::list<int> s21_mutable{4, 5};
+  s21::list<int>::const_reverse_iterator it = s21_mutable.rbegin();
+  EXPECT_EQ(*it, 5);
+  EXPECT_TRUE(++it != s21_mutable.crend());
+  EXPECT_TRUE(++it == s21_mutable.crend());
+
+  const s21::list<int> s21_empty;
+  EXPECT_TRUE(s21_empty.crbegin() == s21_empty.crend());
+  EXPECT_TRUE(s21_empty.reversed().empty());
+}
+
 GTEST_API_ int main() {
   testing::InitGoogleTest();
   return RUN_ALL_TESTS();
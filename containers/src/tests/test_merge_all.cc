@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "../s21_merge_all.h"
+#include "test_fixtures.h"
+
+namespace {
+using s21_test::record;
+
+// k отсортированных списков случайной длины со значениями из [0, range)
+std::vector<s21::list<int>> make_lists(std::size_t k, int range,
+                                       std::vector<int>& all) {
+  std::mt19937 gen(static_cast<unsigned>(k));
+  std::vector<s21::list<int>> lists(k);
+  for (s21::list<int>& source : lists) {
+    std::vector<int> values(gen() % 200);
+    for (int& value : values) value = static_cast<int>(gen() % range);
+    std::sort(values.begin(), values.end());
+    for (int value : values) source.insert(source.end(), value);
+    all.insert(all.end(), values.begin(), values.end());
+  }
+  std::sort(all.begin(), all.end());
+  return lists;
+}
+}  // namespace
+
+TEST(merge_all_test, many_lists) {
+  std::vector<int> expected;
+  std::vector<s21::list<int>> lists = make_lists(64, 1000, expected);
+  s21::list<int> result = s21::merge_all(lists);
+  EXPECT_EQ(result.size(), expected.size());
+  EXPECT_TRUE(std::equal(expected.begin(), expected.end(), result.begin()));
+  EXPECT_EQ(*--result.end(), expected.back());
+  for (s21::list<int>& source : lists) {
+    EXPECT_TRUE(source.empty());
+    EXPECT_TRUE(source.begin() == source.end());
+  }
+}
+
+TEST(merge_all_test, parallel_matches_sequential) {
+  std::vector<int> expected;
+  std::vector<s21::list<int>> lists = make_lists(100, 50, expected);
+  s21::list<int> result = s21::merge_all(lists, std::less<int>(), 4);
+  EXPECT_EQ(result.size(), expected.size());
+  EXPECT_TRUE(std::equal(expected.begin(), expected.end(), result.begin()));
+  for (s21::list<int>& source : lists) EXPECT_TRUE(source.empty());
+}
+
+TEST(merge_all_test, descending_compare) {
+  std::vector<s21::list<int>> lists(3);
+  lists[0] = s21::list<int>{9, 4, 1};
+  lists[1] = s21::list<int>{8, 7};
+  lists[2] = s21::list<int>{5, 3, 2, 0};
+  s21::list<int> result = s21::merge_all(lists, std::greater<int>(), 2);
+  std::vector<int> expected{9, 8, 7, 5, 4, 3, 2, 1, 0};
+  EXPECT_EQ(result.size(), expected.size());
+  EXPECT_TRUE(std::equal(expected.begin(), expected.end(), result.begin()));
+}
+
+TEST(merge_all_test, stable) {
+  std::vector<s21::list<record>> lists(3);
+  for (int i = 0; i < 3; i++) {
+    for (int key = 0; key < 4; key++) {
+      lists[i].insert(lists[i].end(), record(key, i));
+    }
+  }
+  for (std::size_t threads : {1U, 3U}) {
+    std::vector<s21::list<record>> copy;
+    for (s21::list<record>& source : lists) copy.push_back(s21::list<record>(source));
+    s21::list<record> result = s21::merge_all(copy, std::less<record>(), threads);
+    int position = 0;
+    for (auto it = result.begin(); it != result.end(); ++it, ++position) {
+      EXPECT_EQ((*it).key, position / 3);
+      EXPECT_EQ((*it).order, position % 3);
+    }
+    EXPECT_EQ(position, 12);
+  }
+}
+
+TEST(merge_all_test, empty_and_relayout) {
+  std::vector<s21::list<int>> lists(4);
+  s21::list<int> none = s21::merge_all(lists);
+  EXPECT_TRUE(none.empty());
+
+  lists[1] = s21::list<int>{1, 3, 5};
+  lists[3] = s21::list<int>{2, 4};
+  lists[3].relayout();
+  s21::list<int> result = s21::merge_all(lists);
+  std::vector<int> expected{1, 2, 3, 4, 5};
+  EXPECT_TRUE(std::equal(expected.begin(), expected.end(), result.begin()));
+  result.erase(--result.end());
+  EXPECT_EQ(result.back(), 4);
+}
+
+TEST(merge_all_test, throwing_compare_keeps_nodes) {
+  for (std::size_t threads : {1U, 4U}) {
+    std::vector<int> expected;
+    std::vector<s21::list<int>> lists = make_lists(16, 100, expected);
+    lists[2].relayout();
+    std::atomic<int> calls{0};
+    auto comp = [&calls](int a, int b) {
+      if (++calls == 300) throw std::runtime_error("compare failed");
+      return a < b;
+    };
+    EXPECT_THROW(s21::merge_all(lists, comp, threads), std::runtime_error);
+    // Все элементы собраны в первом списке, остальные пусты
+    std::vector<int> kept;
+    for (int value : lists[0]) kept.push_back(value);
+    std::sort(kept.begin(), kept.end());
+    EXPECT_EQ(lists[0].size(), expected.size());
+    EXPECT_EQ(kept, expected);
+    for (std::size_t i = 1; i < lists.size(); i++) EXPECT_TRUE(lists[i].empty());
+  }
+}
@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <list>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "../s21_rcu_list.h"
+
+TEST(rcu_list_test, push_and_read) {
+  s21::rcu_list<int> s21_list{2, 3};
+  s21_list.push_front(1);
+  s21_list.push_back(4);
+  std::list<int> std_list{1, 2, 3, 4};
+  s21::rcu_list<int>::reader reader(s21_list);
+  std::vector<int> seen;
+  reader.for_each([&seen](int value) { seen.push_back(value); });
+  EXPECT_EQ(s21_list.size(), std_list.size());
+  EXPECT_TRUE(std::equal(seen.begin(), seen.end(), std_list.begin()));
+}
+
+TEST(rcu_list_test, insert_erase) {
+  s21::rcu_list<int> s21_list{1, 2, 3};
+  auto pos = s21_list.begin();
+  ++pos;
+  auto inserted = s21_list.insert(pos, 5);
+  s21_list.erase(s21_list.begin());
+  s21_list.erase(inserted);
+  std::list<int> std_list{2, 3};
+  EXPECT_EQ(s21_list.size(), std_list.size());
+  EXPECT_TRUE(std::equal(s21_list.begin(), s21_list.end(), std_list.begin()));
+  EXPECT_THROW(s21_list.erase(s21_list.end()), std::invalid_argument);
+}
+
+TEST(rcu_list_test, splice) {
+  s21::rcu_list<int> s21_this{1, 2, 234};
+  s21::rcu_list<int> s21_other{7584, 154};
+  s21_this.splice(++s21_this.begin(), s21_other);
+  std::list<int> std_list{1, 7584, 154, 2, 234};
+  EXPECT_EQ(s21_this.size(), std_list.size());
+  EXPECT_TRUE(s21_other.empty());
+  EXPECT_TRUE(std::equal(s21_this.begin(), s21_this.end(), std_list.begin()));
+  s21_this.push_back(5);
+  EXPECT_EQ(s21_this.size(), 6U);
+}
+
+TEST(rcu_list_test, clear_and_synchronize) {
+  s21::rcu_list<int> s21_list{1, 2, 3};
+  s21::rcu_list<int>::reader reader(s21_list);
+  reader.lock();
+  auto it = reader.begin();
+  s21_list.clear();
+  // Читатель всё ещё в секции: удалённые узлы доступны
+  EXPECT_EQ(*it, 1);
+  EXPECT_EQ(*++it, 2);
+  reader.unlock();
+  s21_list.synchronize();
+  EXPECT_TRUE(s21_list.empty());
+  EXPECT_EQ(s21_list.size(), 0U);
+}
+
+TEST(rcu_list_test, for_each_throw_unlocks) {
+  s21::rcu_list<int> s21_list{1, 2, 3};
+  s21::rcu_list<int>::reader reader(s21_list);
+  EXPECT_THROW(reader.for_each([](int value) {
+    if (value == 2) throw std::runtime_error("stop");
+  }),
+               std::runtime_error);
+  // Секция чтения закрыта, поэтому период ожидания завершается
+  s21_list.clear();
+  s21_list.synchronize();
+  EXPECT_TRUE(s21_list.empty());
+}
+
+TEST(rcu_list_test, erase_inside_read_section) {
+  s21::rcu_list<int> s21_list;
+  for (int i = 0; i < 200; i++) s21_list.push_back(i);
+  s21::rcu_list<int>::reader reader(s21_list);
+  {
+    s21::rcu_list<int>::read_guard guard(reader);
+    auto it = reader.begin();
+    // Порог освобождения превышен, но писатель сам читает: узлы не освобождаются
+    while (!s21_list.empty()) s21_list.erase(s21_list.begin());
+    EXPECT_EQ(*it, 0);
+    EXPECT_EQ(*++it, 1);
+  }
+  s21_list.synchronize();
+  EXPECT_EQ(s21_list.size(), 0U);
+}
+
+TEST(rcu_list_test, splice_inside_read_section) {
+  s21::rcu_list<int> s21_this{1, 2};
+  s21::rcu_list<int> s21_other{3, 4, 5};
+  s21::rcu_list<int>::reader reader(s21_other);
+  {
+    s21::rcu_list<int>::read_guard guard(reader);
+    auto it = reader.begin();
+    // Период ожидания читателей other здесь не закончился бы никогда
+    s21_this.splice(s21_this.end(), s21_other);
+    EXPECT_EQ(*it, 3);
+    EXPECT_EQ(*++it, 4);
+    EXPECT_EQ(*++it, 5);
+    EXPECT_TRUE(++it == reader.end());
+  }
+  s21_other.synchronize();
+  std::list<int> std_list{1, 2, 3, 4, 5};
+  EXPECT_TRUE(s21_other.empty());
+  EXPECT_EQ(s21_this.size(), std_list.size());
+  EXPECT_TRUE(std::equal(s21_this.begin(), s21_this.end(), std_list.begin()));
+}
+
+TEST(rcu_list_test, concurrent_readers) {
+  s21::rcu_list<int> s21_list;
+  for (int i = 0; i < 100; i++) s21_list.push_back(1);
+  std::atomic<bool> stop{false};
+  std::atomic<bool> ok{true};
+  std::vector<std::thread> readers;
+  for (int t = 0; t < 4; t++) {
+    readers.emplace_back([&]() {
+      s21::rcu_list<int>::reader reader(s21_list);
+      while (!stop.load()) {
+        int sum = 0;
+        reader.for_each([&sum](int value) { sum += value; });
+        // Писатель держит в списке от 100 до 101 элемента
+        if (sum < 100 || sum > 101) ok.store(false);
+      }
+    });
+  }
+  for (int i = 0; i < 2000; i++) {
+    auto inserted = s21_list.insert(s21_list.begin(), 1);
+    s21_list.erase(++s21_list.begin());
+    (void)inserted;
+  }
+  stop.store(true);
+  for (auto& reader : readers) reader.join();
+  EXPECT_TRUE(ok.load());
+  EXPECT_EQ(s21_list.size(), 100U);
+}
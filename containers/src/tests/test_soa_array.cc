@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <numeric>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "../s21_soa_array.h"
+
+using trade = s21::soa_array<std::int64_t, double, int>;
+
+TEST(soa_array_test, constructor_rows) {
+  trade s21_soa{{1, 10.5, 3}, {2, 11.0, 4}, {3, 9.5, 5}};
+  EXPECT_EQ(s21_soa.size(), 3U);
+  EXPECT_EQ(s21_soa.data<0>()[2], 3);
+  EXPECT_EQ(s21_soa.data<1>()[0], 10.5);
+  EXPECT_EQ(s21_soa.data<2>()[1], 4);
+  EXPECT_EQ(std::get<1>(s21_soa[1]), 11.0);
+}
+
+TEST(soa_array_test, empty) {
+  trade s21_soa;
+  EXPECT_TRUE(s21_soa.empty());
+  EXPECT_TRUE(s21_soa.begin() == s21_soa.end());
+  EXPECT_EQ(s21_soa.data<0>(), nullptr);
+  EXPECT_EQ(s21_soa.to_array().size(), 0U);
+}
+
+TEST(soa_array_test, column_scan) {
+  trade s21_soa(100);
+  for (std::size_t i = 0; i < s21_soa.size(); i++) {
+    s21_soa[i] = std::make_tuple(static_cast<std::int64_t>(i), 0.5 * i, 1);
+  }
+  s21::array_view<const double, 1> price = std::as_const(s21_soa).column<1>();
+  double sum = 0;
+  for (std::size_t i = 0; i < price.size(); i++) sum += price(i);
+  EXPECT_DOUBLE_EQ(sum, 0.5 * 4950);
+  const int* qty = std::as_const(s21_soa).data<2>();
+  EXPECT_EQ(std::accumulate(qty, qty + s21_soa.size(), 0), 100);
+}
+
+TEST(soa_array_test, zipped_iterator) {
+  trade s21_soa{{1, 1.0, 1}, {2, 2.0, 2}, {3, 3.0, 3}};
+  for (auto row : s21_soa) std::get<2>(row) *= 10;
+  EXPECT_EQ(s21_soa.data<2>()[2], 30);
+  auto it = s21_soa.begin();
+  EXPECT_EQ(s21_soa.end() - it, 3);
+  EXPECT_EQ(std::get<0>(it[1]), 2);
+  *it = std::make_tuple(std::int64_t(7), 7.5, 70);
+  EXPECT_EQ(std::get<1>(s21_soa.at(0)), 7.5);
+  trade::const_iterator cit = it;
+  EXPECT_TRUE(cit < std::as_const(s21_soa).end());
+  EXPECT_EQ(std::count_if(std::as_const(s21_soa).begin(), std::as_const(s21_soa).end(),
+                          [](const std::tuple<std::int64_t, double, int>& row) {
+                            return std::get<2>(row) >= 30;
+                          }),
+            2);
+}
+
+TEST(soa_array_test, iterator_identity) {
+  static_assert(std::is_same<std::iterator_traits<trade::iterator>::iterator_category,
+                             std::input_iterator_tag>::value,
+                "proxy references cannot satisfy forward iterator requirements");
+  trade s21_first{{1, 1.0, 1}, {2, 2.0, 2}};
+  trade s21_second{{1, 1.0, 1}, {2, 2.0, 2}};
+  EXPECT_TRUE(s21_first.begin() != s21_second.begin());
+  EXPECT_FALSE(s21_first.end() == s21_second.end());
+  EXPECT_TRUE(s21_first.begin() + 2 == s21_first.end());
+  trade::const_iterator cit = s21_first.begin();
+  EXPECT_TRUE(cit == std::as_const(s21_first).begin());
+}
+
+TEST(soa_array_test, to_and_from_array) {
+  s21::array<std::tuple<std::int64_t, double, int>, 2> rows{
+      std::make_tuple(std::int64_t(5), 1.5, 8), std::make_tuple(std::int64_t(6), 2.5, 9)};
+  trade s21_soa(rows);
+  EXPECT_EQ(s21_soa.data<0>()[1], 6);
+  EXPECT_EQ(s21_soa.data<2>()[0], 8);
+  s21::array<std::tuple<std::int64_t, double, int>, 0> back = s21_soa.to_array();
+  EXPECT_EQ(back.size(), 2U);
+  EXPECT_TRUE(back[0] == rows[0]);
+  EXPECT_TRUE(back[1] == rows[1]);
+}
+
+TEST(soa_array_test, copy_on_write) {
+  trade s21_soa{{1, 1.0, 1}, {2, 2.0, 2}};
+  trade s21_copy(s21_soa);
+  EXPECT_EQ(std::as_const(s21_soa).data<1>(), std::as_const(s21_copy).data<1>());
+  s21_copy.data<1>()[0] = 42.0;
+  EXPECT_EQ(s21_soa.data<1>()[0], 1.0);
+  EXPECT_EQ(std::as_const(s21_soa).data<0>(), std::as_const(s21_copy).data<0>());
+  trade s21_clone = s21_soa.clone();
+  EXPECT_NE(std::as_const(s21_soa).data<0>(), std::as_const(s21_clone).data<0>());
+}
+
+TEST(soa_array_test, share_after_row_writes) {
+  trade s21_soa{{1, 1.0, 1}, {2, 2.0, 2}};
+  for (std::size_t i = 0; i < s21_soa.size(); i++) std::get<2>(s21_soa[i]) = 7;
+  trade s21_before(s21_soa);
+  EXPECT_NE(std::as_const(s21_soa).data<0>(), std::as_const(s21_before).data<0>());
+  s21_soa.share();
+  trade s21_snapshot(s21_soa);
+  EXPECT_EQ(std::as_const(s21_soa).data<0>(), std::as_const(s21_snapshot).data<0>());
+  EXPECT_EQ(std::as_const(s21_soa).data<2>(), std::as_const(s21_snapshot).data<2>());
+  // Следующая запись снова отделяет столбцы от снимка
+  std::get<2>(s21_soa[0]) = -1;
+  EXPECT_EQ(std::get<2>(std::as_const(s21_snapshot)[0]), 7);
+}
+
+TEST(soa_array_test, swap_fill) {
+  trade s21_soa(3);
+  trade s21_other{{1, 1.0, 1}};
+  s21_soa.fill(std::make_tuple(std::int64_t(4), 4.0, 4));
+  s21_soa.swap(s21_other);
+  EXPECT_EQ(s21_soa.size(), 1U);
+  EXPECT_EQ(s21_other.size(), 3U);
+  EXPECT_EQ(s21_other.data<0>()[2], 4);
+  EXPECT_EQ(s21_other.data<2>()[0], 4);
+}
+
+TEST(soa_array_test, at_throw) {
+  trade s21_soa(2);
+  EXPECT_THROW(s21_soa.at(2), std::out_of_range);
+  EXPECT_THROW(std::as_const(s21_soa).at(5), std::out_of_range);
+}
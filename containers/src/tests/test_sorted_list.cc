@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <set>
+#include <type_traits>
+#include <vector>
+
+#include "../s21_sorted_list.h"
+
+TEST(sorted_list_test, insert_sorted) {
+  s21::sorted_list<int> s21_list{5, 1, 4, 2, 3, 2};
+  std::multiset<int> std_set{5, 1, 4, 2, 3, 2};
+  EXPECT_EQ(s21_list.size(), std_set.size());
+  EXPECT_TRUE(std::equal(s21_list.begin(), s21_list.end(), std_set.begin()));
+  EXPECT_EQ(s21_list.front(), 1);
+  EXPECT_EQ(s21_list.back(), 5);
+}
+
+TEST(sorted_list_test, reverse_iteration) {
+  s21::sorted_list<int> s21_list{3, 1, 2};
+  std::vector<int> result;
+  for (auto it = s21_list.end(); it != s21_list.begin();) {
+    result.push_back(*--it);
+  }
+  EXPECT_EQ(result, (std::vector<int>{3, 2, 1}));
+}
+
+TEST(sorted_list_test, bounds) {
+  s21::sorted_list<int> s21_list{1, 3, 3, 3, 7};
+  EXPECT_EQ(*s21_list.lower_bound(3), 3);
+  EXPECT_EQ(*s21_list.upper_bound(3), 7);
+  EXPECT_EQ(*s21_list.lower_bound(4), 7);
+  EXPECT_TRUE(s21_list.upper_bound(7) == s21_list.end());
+  auto range = s21_list.equal_range(3);
+  EXPECT_EQ(std::distance(range.first, range.second), 3);
+  EXPECT_TRUE(s21_list.find(5) == s21_list.end());
+  EXPECT_EQ(*s21_list.find(7), 7);
+}
+
+TEST(sorted_list_test, erase_value) {
+  s21::sorted_list<int> s21_list{1, 3, 3, 3, 7};
+  EXPECT_EQ(s21_list.erase(3), 3U);
+  EXPECT_EQ(s21_list.erase(4), 0U);
+  EXPECT_EQ(s21_list.size(), 2U);
+  EXPECT_EQ(s21_list.front(), 1);
+  EXPECT_EQ(s21_list.back(), 7);
+  EXPECT_THROW(s21_list.erase(s21_list.end()), std::invalid_argument);
+}
+
+TEST(sorted_list_test, custom_compare) {
+  s21::sorted_list<int, std::greater<int>> s21_list{1, 5, 3};
+  EXPECT_EQ(s21_list.front(), 5);
+  EXPECT_EQ(*s21_list.lower_bound(4), 3);
+}
+
+TEST(sorted_list_test, merge) {
+  s21::sorted_list<int> s21_this{1, 46, 234};
+  s21::sorted_list<int> s21_other{50, 357, 6028, 1};
+  s21_this.merge(s21_other);
+  std::multiset<int> std_set{1, 46, 234, 50, 357, 6028, 1};
+  EXPECT_TRUE(s21_other.empty());
+  EXPECT_EQ(s21_this.size(), std_set.size());
+  EXPECT_TRUE(std::equal(s21_this.begin(), s21_this.end(), std_set.begin()));
+  s21_other.insert_sorted(2);
+  EXPECT_EQ(s21_other.front(), 2);
+}
+
+TEST(sorted_list_test, random_against_multiset) {
+  s21::sorted_list<int> s21_list;
+  std::multiset<int> std_set;
+  std::mt19937 gen(7);
+  std::uniform_int_distribution<int> value(0, 500);
+  for (int i = 0; i < 5000; i++) {
+    int v = value(gen);
+    if (i % 3 == 2) {
+      EXPECT_EQ(s21_list.erase(v), std_set.erase(v));
+    } else {
+      s21_list.insert_sorted(v);
+      std_set.insert(v);
+    }
+  }
+  EXPECT_EQ(s21_list.size(), std_set.size());
+  EXPECT_TRUE(std::equal(s21_list.begin(), s21_list.end(), std_set.begin()));
+}
+
+TEST(sorted_list_test, copy_and_move) {
+  s21::sorted_list<int> s21_list{3, 1, 2};
+  s21::sorted_list<int> s21_copy(s21_list);
+  s21::sorted_list<int> s21_move(std::move(s21_list));
+  EXPECT_TRUE(s21_list.empty());
+  EXPECT_TRUE(std::equal(s21_copy.begin(), s21_copy.end(), s21_move.begin()));
+  s21_list = std::move(s21_copy);
+  EXPECT_EQ(s21_list.size(), 3U);
+  EXPECT_TRUE(s21_copy.empty());
+}
+
+TEST(sorted_list_test, moved_from_is_usable) {
+  static_assert(std::is_nothrow_move_constructible<s21::sorted_list<int>>::value,
+                "sorted_list move constructor should be noexcept");
+  static_assert(std::is_nothrow_move_assignable<s21::sorted_list<int>>::value,
+                "sorted_list move assignment should be noexcept");
+  s21::sorted_list<int> s21_list{3, 1, 2};
+  s21::sorted_list<int> s21_move(std::move(s21_list));
+  EXPECT_TRUE(s21_list.begin() == s21_list.end());
+  EXPECT_TRUE(s21_list.find(2) == s21_list.end());
+  EXPECT_EQ(s21_list.erase(2), 0U);
+  EXPECT_THROW(s21_list.erase(s21_list.end()), std::invalid_argument);
+  s21_list.merge(s21_move);
+  EXPECT_TRUE(s21_move.empty());
+  s21_list.insert_sorted(0);
+  std::vector<int> expected{0, 1, 2, 3};
+  EXPECT_EQ(s21_list.size(), expected.size());
+  EXPECT_TRUE(std::equal(expected.begin(), expected.end(), s21_list.begin()));
+  EXPECT_EQ(s21_list.back(), 3);
+}